@@ -0,0 +1,107 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/VerifyGlobs.cmake"
+  "CMakeFiles/cmake.verify_globs"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/BoostDetectToolset-1.74.0.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/boost_filesystem-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/boost_filesystem-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/libboost_filesystem-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/libboost_filesystem-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/boost_system-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/boost_system-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/libboost_system-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/libboost_system-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/boost_unit_test_framework-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/boost_unit_test_framework-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/libboost_unit_test_framework-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/libboost_unit_test_framework-variant-static.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/main_grid_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/main_asymm_sir.dir/DependInfo.cmake"
+  "CMakeFiles/main_dense_grid_sir.dir/DependInfo.cmake"
+  "CMakeFiles/main_grid_sir.dir/DependInfo.cmake"
+  "CMakeFiles/main_grid_sir_batch.dir/DependInfo.cmake"
+  "CMakeFiles/main_grid_sir_board.dir/DependInfo.cmake"
+  "CMakeFiles/main_sparse_grid_sir.dir/DependInfo.cmake"
+  "CMakeFiles/main_devstone.dir/DependInfo.cmake"
+  "CMakeFiles/main_flat_devstone.dir/DependInfo.cmake"
+  "CMakeFiles/main_efp.dir/DependInfo.cmake"
+  "CMakeFiles/main_gpt.dir/DependInfo.cmake"
+  "CMakeFiles/main_iestream.dir/DependInfo.cmake"
+  "CMakeFiles/parallel_main_asymm_sir.dir/DependInfo.cmake"
+  "CMakeFiles/parallel_main_dense_grid_sir.dir/DependInfo.cmake"
+  "CMakeFiles/parallel_main_grid_sir.dir/DependInfo.cmake"
+  "CMakeFiles/parallel_main_grid_sir_ensemble.dir/DependInfo.cmake"
+  "CMakeFiles/parallel_main_tiled_grid_sir.dir/DependInfo.cmake"
+  "CMakeFiles/parallel_main_devstone.dir/DependInfo.cmake"
+  "CMakeFiles/parallel_main_efp.dir/DependInfo.cmake"
+  "CMakeFiles/parallel_main_gpt.dir/DependInfo.cmake"
+  "CMakeFiles/distributed_main_efp.dir/DependInfo.cmake"
+  "CMakeFiles/test_batch_sir.dir/DependInfo.cmake"
+  "CMakeFiles/test_cell_sir.dir/DependInfo.cmake"
+  "CMakeFiles/test_celldevs_queue.dir/DependInfo.cmake"
+  "CMakeFiles/test_atomic.dir/DependInfo.cmake"
+  "CMakeFiles/test_coupled.dir/DependInfo.cmake"
+  "CMakeFiles/test_port.dir/DependInfo.cmake"
+  "CMakeFiles/test_time.dir/DependInfo.cmake"
+  "CMakeFiles/test_calendar_devstone.dir/DependInfo.cmake"
+  "CMakeFiles/test_devstone.dir/DependInfo.cmake"
+  "CMakeFiles/test_parallel_devstone.dir/DependInfo.cmake"
+  "CMakeFiles/test_distributed_efp_gpt.dir/DependInfo.cmake"
+  "CMakeFiles/test_parallel_efp_gpt.dir/DependInfo.cmake"
+  "CMakeFiles/test_grid_scenario.dir/DependInfo.cmake"
+  "CMakeFiles/test_grid_sir.dir/DependInfo.cmake"
+  "CMakeFiles/test_grid_stencil.dir/DependInfo.cmake"
+  "CMakeFiles/test_parallel_tiled_sir.dir/DependInfo.cmake"
+  )
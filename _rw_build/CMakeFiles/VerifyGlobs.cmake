@@ -0,0 +1,161 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by CMake Version 3.25
+cmake_policy(SET CMP0009 NEW)
+
+# directorySrc at CMakeLists.txt:74 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/atomic/src/*.cpp")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# directorySrc at CMakeLists.txt:22 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/celldevs_benchmark/src/*.cpp")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/celldevs_sir/src/*.cpp")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# directorySrc at CMakeLists.txt:74 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/coupled/src/*.cpp")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:74 (file)
+# directorySrc at CMakeLists.txt:74 (file)
+# directorySrc at CMakeLists.txt:74 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/devstone/src/*.cpp")
+set(OLD_GLOB
+  "/root/repo/example/devstone/src/devstone.cpp"
+  "/root/repo/example/devstone/src/devstone_atomic.cpp"
+  "/root/repo/example/devstone/src/devstone_coupled.cpp"
+  "/root/repo/example/devstone/src/devstone_coupled_hi.cpp"
+  "/root/repo/example/devstone/src/devstone_coupled_ho.cpp"
+  "/root/repo/example/devstone/src/devstone_coupled_homod.cpp"
+  "/root/repo/example/devstone/src/devstone_coupled_li.cpp"
+  "/root/repo/example/devstone/src/devstone_generator.cpp"
+  "/root/repo/example/devstone/src/dhrystone.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+# directorySrc at CMakeLists.txt:22 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/efp_gpt/src/*.cpp")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# directorySrc at CMakeLists.txt:74 (file)
+# directorySrc at CMakeLists.txt:74 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/gpt/src/*.cpp")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# directorySrc at CMakeLists.txt:22 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/iestream/src/*.cpp")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# directorySrc at CMakeLists.txt:74 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/port/src/*.cpp")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# directorySrc at CMakeLists.txt:74 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/queue/src/*.cpp")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# directorySrc at CMakeLists.txt:74 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/scenario/src/*.cpp")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# directorySrc at CMakeLists.txt:74 (file)
+# directorySrc at CMakeLists.txt:74 (file)
+# directorySrc at CMakeLists.txt:74 (file)
+# directorySrc at CMakeLists.txt:74 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/sir/src/*.cpp")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# directorySrc at CMakeLists.txt:74 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/stencil/src/*.cpp")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# directorySrc at CMakeLists.txt:74 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/example/time/src/*.cpp")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_rw_build/CMakeFiles/cmake.verify_globs")
+endif()
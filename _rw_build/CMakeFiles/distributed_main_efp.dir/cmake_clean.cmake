@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/distributed_main_efp"
+  "/root/repo/bin/distributed_main_efp.pdb"
+  "CMakeFiles/distributed_main_efp.dir/example/efp_gpt/distributed_main_efp.cpp.o"
+  "CMakeFiles/distributed_main_efp.dir/example/efp_gpt/distributed_main_efp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/distributed_main_efp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/main_asymm_sir"
+  "/root/repo/bin/main_asymm_sir.pdb"
+  "CMakeFiles/main_asymm_sir.dir/example/celldevs_sir/main_asymm_sir.cpp.o"
+  "CMakeFiles/main_asymm_sir.dir/example/celldevs_sir/main_asymm_sir.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main_asymm_sir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
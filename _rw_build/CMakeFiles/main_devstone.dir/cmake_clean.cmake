@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/main_devstone"
+  "/root/repo/bin/main_devstone.pdb"
+  "CMakeFiles/main_devstone.dir/example/devstone/main_devstone.cpp.o"
+  "CMakeFiles/main_devstone.dir/example/devstone/main_devstone.cpp.o.d"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone.cpp.o"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone.cpp.o.d"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_atomic.cpp.o"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_atomic.cpp.o.d"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_coupled.cpp.o"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_coupled.cpp.o.d"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_coupled_hi.cpp.o"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_coupled_hi.cpp.o.d"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_coupled_ho.cpp.o"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_coupled_ho.cpp.o.d"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_coupled_homod.cpp.o"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_coupled_homod.cpp.o.d"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_coupled_li.cpp.o"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_coupled_li.cpp.o.d"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_generator.cpp.o"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/devstone_generator.cpp.o.d"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/dhrystone.cpp.o"
+  "CMakeFiles/main_devstone.dir/example/devstone/src/dhrystone.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main_devstone.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
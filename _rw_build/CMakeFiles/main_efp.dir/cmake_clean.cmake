@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/main_efp"
+  "/root/repo/bin/main_efp.pdb"
+  "CMakeFiles/main_efp.dir/example/efp_gpt/main_efp.cpp.o"
+  "CMakeFiles/main_efp.dir/example/efp_gpt/main_efp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main_efp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/main_gpt"
+  "/root/repo/bin/main_gpt.pdb"
+  "CMakeFiles/main_gpt.dir/example/efp_gpt/main_gpt.cpp.o"
+  "CMakeFiles/main_gpt.dir/example/efp_gpt/main_gpt.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main_gpt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/main_grid_benchmark"
+  "/root/repo/bin/main_grid_benchmark.pdb"
+  "CMakeFiles/main_grid_benchmark.dir/example/celldevs_benchmark/main_grid_benchmark.cpp.o"
+  "CMakeFiles/main_grid_benchmark.dir/example/celldevs_benchmark/main_grid_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main_grid_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
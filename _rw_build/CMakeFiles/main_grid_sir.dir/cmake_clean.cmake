@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/main_grid_sir"
+  "/root/repo/bin/main_grid_sir.pdb"
+  "CMakeFiles/main_grid_sir.dir/example/celldevs_sir/main_grid_sir.cpp.o"
+  "CMakeFiles/main_grid_sir.dir/example/celldevs_sir/main_grid_sir.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main_grid_sir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/main_grid_sir_batch"
+  "/root/repo/bin/main_grid_sir_batch.pdb"
+  "CMakeFiles/main_grid_sir_batch.dir/example/celldevs_sir/main_grid_sir_batch.cpp.o"
+  "CMakeFiles/main_grid_sir_batch.dir/example/celldevs_sir/main_grid_sir_batch.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main_grid_sir_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
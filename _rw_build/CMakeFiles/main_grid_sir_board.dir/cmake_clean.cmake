@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/main_grid_sir_board"
+  "/root/repo/bin/main_grid_sir_board.pdb"
+  "CMakeFiles/main_grid_sir_board.dir/example/celldevs_sir/main_grid_sir_board.cpp.o"
+  "CMakeFiles/main_grid_sir_board.dir/example/celldevs_sir/main_grid_sir_board.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main_grid_sir_board.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/main_iestream"
+  "/root/repo/bin/main_iestream.pdb"
+  "CMakeFiles/main_iestream.dir/example/iestream/main_iestream.cpp.o"
+  "CMakeFiles/main_iestream.dir/example/iestream/main_iestream.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/main_iestream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
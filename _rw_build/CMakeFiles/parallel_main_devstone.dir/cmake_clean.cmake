@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/parallel_main_devstone"
+  "/root/repo/bin/parallel_main_devstone.pdb"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/parallel_main_devstone.cpp.o"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/parallel_main_devstone.cpp.o.d"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone.cpp.o"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone.cpp.o.d"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_atomic.cpp.o"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_atomic.cpp.o.d"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_coupled.cpp.o"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_coupled.cpp.o.d"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_coupled_hi.cpp.o"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_coupled_hi.cpp.o.d"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_coupled_ho.cpp.o"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_coupled_ho.cpp.o.d"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_coupled_homod.cpp.o"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_coupled_homod.cpp.o.d"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_coupled_li.cpp.o"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_coupled_li.cpp.o.d"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_generator.cpp.o"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/devstone_generator.cpp.o.d"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/dhrystone.cpp.o"
+  "CMakeFiles/parallel_main_devstone.dir/example/devstone/src/dhrystone.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parallel_main_devstone.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/parallel_main_efp"
+  "/root/repo/bin/parallel_main_efp.pdb"
+  "CMakeFiles/parallel_main_efp.dir/example/efp_gpt/parallel_main_efp.cpp.o"
+  "CMakeFiles/parallel_main_efp.dir/example/efp_gpt/parallel_main_efp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parallel_main_efp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/parallel_main_gpt"
+  "/root/repo/bin/parallel_main_gpt.pdb"
+  "CMakeFiles/parallel_main_gpt.dir/example/efp_gpt/parallel_main_gpt.cpp.o"
+  "CMakeFiles/parallel_main_gpt.dir/example/efp_gpt/parallel_main_gpt.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parallel_main_gpt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/parallel_main_grid_sir_ensemble"
+  "/root/repo/bin/parallel_main_grid_sir_ensemble.pdb"
+  "CMakeFiles/parallel_main_grid_sir_ensemble.dir/example/celldevs_sir/parallel_main_grid_sir_ensemble.cpp.o"
+  "CMakeFiles/parallel_main_grid_sir_ensemble.dir/example/celldevs_sir/parallel_main_grid_sir_ensemble.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parallel_main_grid_sir_ensemble.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
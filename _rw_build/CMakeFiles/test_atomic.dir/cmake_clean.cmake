@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_atomic"
+  "/root/repo/bin/test_atomic.pdb"
+  "CMakeFiles/test_atomic.dir/test/core_modeling/test_atomic.cpp.o"
+  "CMakeFiles/test_atomic.dir/test/core_modeling/test_atomic.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_atomic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
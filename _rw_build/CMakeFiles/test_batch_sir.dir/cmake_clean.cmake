@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_batch_sir"
+  "/root/repo/bin/test_batch_sir.pdb"
+  "CMakeFiles/test_batch_sir.dir/test/core_celldevs/test_batch_sir.cpp.o"
+  "CMakeFiles/test_batch_sir.dir/test/core_celldevs/test_batch_sir.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_batch_sir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
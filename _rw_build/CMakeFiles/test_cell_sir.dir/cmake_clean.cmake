@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_cell_sir"
+  "/root/repo/bin/test_cell_sir.pdb"
+  "CMakeFiles/test_cell_sir.dir/test/core_celldevs/test_cell_sir.cpp.o"
+  "CMakeFiles/test_cell_sir.dir/test/core_celldevs/test_cell_sir.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cell_sir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
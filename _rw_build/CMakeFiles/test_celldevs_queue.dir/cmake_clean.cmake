@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_celldevs_queue"
+  "/root/repo/bin/test_celldevs_queue.pdb"
+  "CMakeFiles/test_celldevs_queue.dir/test/core_celldevs/test_celldevs_queue.cpp.o"
+  "CMakeFiles/test_celldevs_queue.dir/test/core_celldevs/test_celldevs_queue.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_celldevs_queue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
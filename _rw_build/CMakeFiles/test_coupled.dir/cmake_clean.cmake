@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_coupled"
+  "/root/repo/bin/test_coupled.pdb"
+  "CMakeFiles/test_coupled.dir/test/core_modeling/test_coupled.cpp.o"
+  "CMakeFiles/test_coupled.dir/test/core_modeling/test_coupled.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coupled.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_grid_scenario"
+  "/root/repo/bin/test_grid_scenario.pdb"
+  "CMakeFiles/test_grid_scenario.dir/test/grid_celldevs/test_grid_scenario.cpp.o"
+  "CMakeFiles/test_grid_scenario.dir/test/grid_celldevs/test_grid_scenario.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_grid_scenario.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_grid_sir"
+  "/root/repo/bin/test_grid_sir.pdb"
+  "CMakeFiles/test_grid_sir.dir/test/grid_celldevs/test_grid_sir.cpp.o"
+  "CMakeFiles/test_grid_sir.dir/test/grid_celldevs/test_grid_sir.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_grid_sir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_grid_stencil"
+  "/root/repo/bin/test_grid_stencil.pdb"
+  "CMakeFiles/test_grid_stencil.dir/test/grid_celldevs/test_grid_stencil.cpp.o"
+  "CMakeFiles/test_grid_stencil.dir/test/grid_celldevs/test_grid_stencil.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_grid_stencil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/example/devstone/src/devstone.cpp" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone.cpp.o" "gcc" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone.cpp.o.d"
+  "/root/repo/example/devstone/src/devstone_atomic.cpp" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_atomic.cpp.o" "gcc" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_atomic.cpp.o.d"
+  "/root/repo/example/devstone/src/devstone_coupled.cpp" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_coupled.cpp.o" "gcc" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_coupled.cpp.o.d"
+  "/root/repo/example/devstone/src/devstone_coupled_hi.cpp" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_coupled_hi.cpp.o" "gcc" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_coupled_hi.cpp.o.d"
+  "/root/repo/example/devstone/src/devstone_coupled_ho.cpp" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_coupled_ho.cpp.o" "gcc" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_coupled_ho.cpp.o.d"
+  "/root/repo/example/devstone/src/devstone_coupled_homod.cpp" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_coupled_homod.cpp.o" "gcc" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_coupled_homod.cpp.o.d"
+  "/root/repo/example/devstone/src/devstone_coupled_li.cpp" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_coupled_li.cpp.o" "gcc" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_coupled_li.cpp.o.d"
+  "/root/repo/example/devstone/src/devstone_generator.cpp" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_generator.cpp.o" "gcc" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/devstone_generator.cpp.o.d"
+  "/root/repo/example/devstone/src/dhrystone.cpp" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/dhrystone.cpp.o" "gcc" "CMakeFiles/test_parallel_devstone.dir/example/devstone/src/dhrystone.cpp.o.d"
+  "/root/repo/test/devstone/test_parallel_devstone.cpp" "CMakeFiles/test_parallel_devstone.dir/test/devstone/test_parallel_devstone.cpp.o" "gcc" "CMakeFiles/test_parallel_devstone.dir/test/devstone/test_parallel_devstone.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
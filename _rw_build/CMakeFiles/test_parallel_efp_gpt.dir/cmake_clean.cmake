@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_parallel_efp_gpt"
+  "/root/repo/bin/test_parallel_efp_gpt.pdb"
+  "CMakeFiles/test_parallel_efp_gpt.dir/test/efp_gpt/test_parallel_efp_gpt.cpp.o"
+  "CMakeFiles/test_parallel_efp_gpt.dir/test/efp_gpt/test_parallel_efp_gpt.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_parallel_efp_gpt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
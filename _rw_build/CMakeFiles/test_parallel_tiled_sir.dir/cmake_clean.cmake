@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_parallel_tiled_sir"
+  "/root/repo/bin/test_parallel_tiled_sir.pdb"
+  "CMakeFiles/test_parallel_tiled_sir.dir/test/grid_celldevs/test_parallel_tiled_sir.cpp.o"
+  "CMakeFiles/test_parallel_tiled_sir.dir/test/grid_celldevs/test_parallel_tiled_sir.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_parallel_tiled_sir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
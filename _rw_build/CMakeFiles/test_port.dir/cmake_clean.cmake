@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_port"
+  "/root/repo/bin/test_port.pdb"
+  "CMakeFiles/test_port.dir/test/core_modeling/test_port.cpp.o"
+  "CMakeFiles/test_port.dir/test/core_modeling/test_port.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_port.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "/root/repo/bin/test_time"
+  "/root/repo/bin/test_time.pdb"
+  "CMakeFiles/test_time.dir/test/core_modeling/test_time.cpp.o"
+  "CMakeFiles/test_time.dir/test/core_modeling/test_time.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_time.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
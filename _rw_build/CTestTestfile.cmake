@@ -0,0 +1,38 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_rw_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_batch_sir "/root/repo/bin/test_batch_sir")
+set_tests_properties(test_batch_sir PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_cell_sir "/root/repo/bin/test_cell_sir")
+set_tests_properties(test_cell_sir PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_celldevs_queue "/root/repo/bin/test_celldevs_queue")
+set_tests_properties(test_celldevs_queue PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_atomic "/root/repo/bin/test_atomic")
+set_tests_properties(test_atomic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_coupled "/root/repo/bin/test_coupled")
+set_tests_properties(test_coupled PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_port "/root/repo/bin/test_port")
+set_tests_properties(test_port PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_time "/root/repo/bin/test_time")
+set_tests_properties(test_time PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_calendar_devstone "/root/repo/bin/test_calendar_devstone")
+set_tests_properties(test_calendar_devstone PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_devstone "/root/repo/bin/test_devstone")
+set_tests_properties(test_devstone PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_parallel_devstone "/root/repo/bin/test_parallel_devstone")
+set_tests_properties(test_parallel_devstone PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_distributed_efp_gpt "/root/repo/bin/test_distributed_efp_gpt")
+set_tests_properties(test_distributed_efp_gpt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_parallel_efp_gpt "/root/repo/bin/test_parallel_efp_gpt")
+set_tests_properties(test_parallel_efp_gpt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_grid_scenario "/root/repo/bin/test_grid_scenario")
+set_tests_properties(test_grid_scenario PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_grid_sir "/root/repo/bin/test_grid_sir")
+set_tests_properties(test_grid_sir PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_grid_stencil "/root/repo/bin/test_grid_stencil")
+set_tests_properties(test_grid_stencil PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(test_parallel_tiled_sir "/root/repo/bin/test_parallel_tiled_sir")
+set_tests_properties(test_parallel_tiled_sir PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;82;add_test;/root/repo/CMakeLists.txt;0;")
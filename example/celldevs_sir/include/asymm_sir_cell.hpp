@@ -44,6 +44,11 @@
 			 return 1.;
 		 }
 
+		 bool constantDelay(double& delay) const override {
+			 delay = 1.;
+			 return true;
+		 }
+
 		 //! It computes the ratio of new infections in the cell.
 		 [[nodiscard]] double newInfections(const SIRState& state,
 			 const std::unordered_map<std::string, NeighborData<SIRState, double>>& neighborhood) const {
@@ -0,0 +1,94 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_EXAMPLE_CELLDEVS_SIR_BATCH_STATE_HPP_
+#define CADMIUM_EXAMPLE_CELLDEVS_SIR_BATCH_STATE_HPP_
+
+#include <array>
+#include <cadmium/celldevs/core/batch.hpp>
+#include <cadmium/core/exception.hpp>
+#include <cstddef>
+#include <iostream>
+#include <nlohmann/json.hpp>
+
+namespace cadmium::celldevs::example::sir {
+	/**
+	 * It reads a lane-wise parameter from a JSON object.
+	 * Numbers are broadcast to all the lanes, while arrays must contain one value per lane.
+	 * @tparam T data type of the parameter.
+	 * @tparam K number of lanes.
+	 * @param j JSON object.
+	 * @param lanes array to store the value of every lane.
+	 */
+	template <typename T, std::size_t K>
+	void lanesFromJson(const nlohmann::json& j, std::array<T, K>& lanes) {
+		if (!j.is_array()) {
+			lanes.fill(j.get<T>());
+		} else if (j.size() == K) {
+			j.get_to(lanes);
+		} else {
+			throw CadmiumModelException("number of values does not match the number of lanes");
+		}
+	}
+
+	//! Susceptible-Infected-Recovered state of K replications in structure-of-arrays form.
+	template <std::size_t K>
+	struct SIRBatchState: public BatchState<K> {
+		std::array<int, K> p;     //!< Cell population.
+		std::array<double, K> s;  //!< Ratio of susceptible people (from 0 to 1).
+		std::array<double, K> i;  //!< Ratio of infected people (from 0 to 1).
+		std::array<double, K> r;  //!< Ratio of recovered people (from 0 to 1).
+
+		//! Default constructor function. By default, cells are unoccupied and all the population is considered susceptible.
+		SIRBatchState(): BatchState<K>(), p(), s(), i(), r() {
+			s.fill(1);
+		}
+
+		//! It copies one lane of another batch state.
+		void copyLane(const SIRBatchState<K>& from, std::size_t lane) {
+			p[lane] = from.p[lane];
+			s[lane] = from.s[lane];
+			i[lane] = from.i[lane];
+			r[lane] = from.r[lane];
+		}
+
+		//! It returns true if one lane of both batch states is different.
+		[[nodiscard]] bool laneDiffers(const SIRBatchState<K>& other, std::size_t lane) const {
+			return p[lane] != other.p[lane] || s[lane] != other.s[lane] || i[lane] != other.i[lane] || r[lane] != other.r[lane];
+		}
+	};
+
+	//! It returns true if any lane of x and y is different.
+	template <std::size_t K>
+	inline bool operator!=(const SIRBatchState<K>& x, const SIRBatchState<K>& y) {
+		for (std::size_t k = 0; k < K; ++k) {
+			if (x.laneDiffers(y, k)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	//! It prints a SIR batch state in an output stream. Lanes are separated by blank spaces.
+	template <std::size_t K>
+	std::ostream& operator<<(std::ostream& os, const SIRBatchState<K>& x) {
+		for (std::size_t k = 0; k < K; ++k) {
+			os << ((k == 0) ? "<" : " <") << x.p[k] << "," << x.s[k] << "," << x.i[k] << "," << x.r[k] << ">";
+		}
+		return os;
+	}
+
+	//! It parses a JSON file and generates the corresponding SIR batch state object.
+	template <std::size_t K>
+	[[maybe_unused]] void from_json(const nlohmann::json& j, SIRBatchState<K>& s) {
+		lanesFromJson(j.at("p"), s.p);
+		lanesFromJson(j.at("s"), s.s);
+		lanesFromJson(j.at("i"), s.i);
+		lanesFromJson(j.at("r"), s.r);
+	}
+}  // namespace cadmium::celldevs::example::sir
+
+#endif //CADMIUM_EXAMPLE_CELLDEVS_SIR_BATCH_STATE_HPP_
@@ -0,0 +1,65 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_EXAMPLE_CELLDEVS_SIR_DENSE_GRID_RULE_HPP_
+#define CADMIUM_EXAMPLE_CELLDEVS_SIR_DENSE_GRID_RULE_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <cadmium/celldevs/grid/config.hpp>
+#include <cadmium/celldevs/grid/dense.hpp>
+#include "state.hpp"
+
+namespace cadmium::celldevs::example::sir {
+	//! Susceptible-Infected-Recovered rule for dense grid scenarios. It behaves as GridSIRCell.
+	class DenseGridSIRRule : public DenseGridRule<SIRState, double> {
+		double rec;   //!< recovery factor.
+		double susc;  //!< susceptibility factor.
+		double vir;   //!< virulence factor.
+	 public:
+		explicit DenseGridSIRRule(const std::shared_ptr<const GridCellConfig<SIRState, double>>& config): rec(), susc(), vir() {
+			config->rawCellConfig.at("rec").get_to(rec);
+			config->rawCellConfig.at("susc").get_to(susc);
+			config->rawCellConfig.at("vir").get_to(vir);
+		}
+
+		[[nodiscard]] SIRState localComputation(SIRState state, const DenseNeighborhood<SIRState, double>& neighborhood) const override {
+			auto newI = newInfections(state, neighborhood);
+			auto newR = newRecoveries(state);
+
+			// We round the outcome to three decimals:
+			state.r = std::round((state.r + newR) * 1000) / 1000;
+			state.i = std::round((state.i + newI - newR) * 1000) / 1000;
+			state.s = 1 - state.i - state.r;
+			return state;
+		}
+
+		[[nodiscard]] double outputDelay(const SIRState&) const override {
+			return 1.;
+		}
+
+		bool constantDelay(double& delay) const override {
+			delay = 1.;
+			return true;
+		}
+
+		[[nodiscard]] double newInfections(const SIRState& state, const DenseNeighborhood<SIRState, double>& neighborhood) const {
+			double aux = 0;
+			for (const auto& [s, v]: neighborhood) {
+				aux += s.i * (double)s.p * v;
+			}
+			return state.s * susc * std::min(1., vir * aux / state.p);
+		}
+
+		[[nodiscard]] double newRecoveries(const SIRState& state) const {
+			return state.i * rec;
+		}
+	};
+}  //namespace cadmium::celldevs::example::sir
+
+#endif //CADMIUM_EXAMPLE_CELLDEVS_SIR_DENSE_GRID_RULE_HPP_
@@ -0,0 +1,72 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_EXAMPLE_CELLDEVS_SIR_GRID_BATCH_CELL_HPP_
+#define CADMIUM_EXAMPLE_CELLDEVS_SIR_GRID_BATCH_CELL_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <nlohmann/json.hpp>
+#include <cadmium/celldevs/core/batch.hpp>
+#include <cadmium/celldevs/grid/cell.hpp>
+#include <cadmium/celldevs/grid/config.hpp>
+#include "batch_state.hpp"
+
+namespace cadmium::celldevs::example::sir {
+	/**
+	 * Grid Susceptible-Infected-Recovered cell that simulates K replications at once.
+	 * Each lane reproduces the behavior of GridSIRCell with the corresponding lane parameters.
+	 * @tparam K number of lanes.
+	 */
+	template <std::size_t K>
+	class GridSIRBatchCell : public BatchCell<coordinates, SIRBatchState<K>, double, double, GridCell<SIRBatchState<K>, double>> {
+		std::array<double, K> rec;   //!< recovery factor of every lane.
+		std::array<double, K> susc;  //!< susceptibility factor of every lane.
+		std::array<double, K> vir;   //!< virulence factor of every lane.
+	 public:
+		GridSIRBatchCell(const std::vector<int>& id, const std::shared_ptr<const GridCellConfig<SIRBatchState<K>, double>>& config):
+		  BatchCell<coordinates, SIRBatchState<K>, double, double, GridCell<SIRBatchState<K>, double>>(id, config), rec(), susc(), vir() {
+			lanesFromJson(config->rawCellConfig.at("rec"), rec);
+			lanesFromJson(config->rawCellConfig.at("susc"), susc);
+			lanesFromJson(config->rawCellConfig.at("vir"), vir);
+		}
+
+		[[nodiscard]] SIRBatchState<K> localComputation(SIRBatchState<K> state, NeighborSpan<SIRBatchState<K>, double> neighbors) const override {
+			// Neighbors are visited in the same (stencil) order as in GridSIRCell, so every lane gets the same rounding errors
+			std::array<double, K> aux{};
+			for (const auto& [neighborState, v]: neighbors) {
+				const auto& s = *neighborState;
+				#pragma omp simd
+				for (std::size_t k = 0; k < K; ++k) {
+					aux[k] += s.i[k] * (double)s.p[k] * v;
+				}
+			}
+			#pragma omp simd
+			for (std::size_t k = 0; k < K; ++k) {
+				auto newI = state.s[k] * susc[k] * std::min(1., vir[k] * aux[k] / state.p[k]);
+				auto newR = state.i[k] * rec[k];
+				// We round the outcome to three decimals:
+				state.r[k] = std::round((state.r[k] + newR) * 1000) / 1000;
+				state.i[k] = std::round((state.i[k] + newI - newR) * 1000) / 1000;
+				state.s[k] = 1 - state.i[k] - state.r[k];
+			}
+			return state;
+		}
+
+		[[nodiscard]] double outputDelay(const SIRBatchState<K>&) const override {
+			return 1.;
+		}
+
+		bool constantDelay(double& delay) const override {
+			delay = 1.;
+			return true;
+		}
+	};
+}  //namespace cadmium::celldevs::example::sir
+
+#endif //CADMIUM_EXAMPLE_CELLDEVS_SIR_GRID_BATCH_CELL_HPP_
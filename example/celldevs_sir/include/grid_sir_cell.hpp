@@ -14,22 +14,21 @@
 #include "state.hpp"
 
 namespace cadmium::celldevs::example::sir {
-	//! Grid Susceptible-Infected-Recovered cell.
-	class GridSIRCell : public GridCell<SIRState, double> {
+	//! Grid Susceptible-Infected-Recovered cell for two-dimensional scenarios.
+	class GridSIRCell final : public GridCell<SIRState, double, 2> {
 		double rec;   //!< recovery factor.
 		double susc;  //!< susceptibility factor.
 		double vir;   //!< virulence factor.
 	 public:
-		GridSIRCell(const std::vector<int>& id, const std::shared_ptr<const GridCellConfig<SIRState, double>>& config):
-		  GridCell<SIRState, double>(id, config), rec(), susc(), vir() {
+		GridSIRCell(const coordinates& id, const std::shared_ptr<const GridCellConfig<SIRState, double, 2>>& config):
+		  GridCell<SIRState, double, 2>(id, config), rec(), susc(), vir() {
 			config->rawCellConfig.at("rec").get_to(rec);
 			config->rawCellConfig.at("susc").get_to(susc);
 			config->rawCellConfig.at("vir").get_to(vir);
 		}
 
-		[[nodiscard]] SIRState localComputation(SIRState state,
-		  const std::unordered_map<std::vector<int>, NeighborData<SIRState, double>>& neighborhood) const override {
-			auto newI = newInfections(state, neighborhood);
+		[[nodiscard]] SIRState localComputation(SIRState state, NeighborSpan<SIRState, double> neighbors) const override {
+			auto newI = newInfections(state, neighbors);
 			auto newR = newRecoveries(state);
 
 			// We round the outcome to three decimals:
@@ -43,12 +42,14 @@ namespace cadmium::celldevs::example::sir {
 			return 1.;
 		}
 
-		[[nodiscard]] double newInfections(const SIRState& state,
-			const std::unordered_map<std::vector<int>, NeighborData<SIRState, double>>& neighborhood) const {
+		bool constantDelay(double& delay) const override {
+			delay = 1.;
+			return true;
+		}
+
+		[[nodiscard]] double newInfections(const SIRState& state, NeighborSpan<SIRState, double> neighbors) const {
 			double aux = 0;
-			for (const auto& [neighborId, neighborData]: neighborhood) {
-				auto s = neighborData.state;
-				auto v = neighborData.vicinity;
+			for (const auto& [s, v]: neighbors) {
 				aux += s->i * (double)s->p * v;
 			}
 			return state.s * susc * std::min(1., vir * aux / state.p);
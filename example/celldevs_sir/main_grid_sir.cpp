@@ -15,7 +15,7 @@
 using namespace cadmium::celldevs;
 using namespace cadmium::celldevs::example::sir;
 
-std::shared_ptr<GridCell<SIRState, double>> addGridCell(const coordinates & cellId, const std::shared_ptr<const GridCellConfig<SIRState, double>>& cellConfig) {
+std::shared_ptr<GridCell<SIRState, double, 2>> addGridCell(const gridCoordinates<2> & cellId, const std::shared_ptr<const GridCellConfig<SIRState, double, 2>>& cellConfig) {
 	auto cellModel = cellConfig->cellModel;
 	if (cellModel == "default" || cellModel == "SIR") {
 		return std::make_shared<GridSIRCell>(cellId, cellConfig);
@@ -34,7 +34,7 @@ int main(int argc, char ** argv) {
 	double simTime = (argc > 2)? std::stod(argv[2]) : 500;
 	auto paramsProcessed = std::chrono::high_resolution_clock::now();
 
-	auto model = std::make_shared<GridCellDEVSCoupled<SIRState, double>>("sir", addGridCell, configFilePath);
+	auto model = std::make_shared<GridCellDEVSCoupled<SIRState, double, 2>>("sir", addGridCell, configFilePath);
 	model->buildModel();
 	auto modelGenerated = std::chrono::high_resolution_clock::now();
 	std::cout << "Model creation time: " << std::chrono::duration_cast<std::chrono::duration<double, std::ratio<1>>>( modelGenerated - paramsProcessed).count() << " seconds" << std::endl;
@@ -0,0 +1,53 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#include <cadmium/celldevs/grid/dense.hpp>
+#include <cadmium/core/logger/csv.hpp>
+#include <chrono>
+#include <fstream>
+#include <omp.h>
+#include <string>
+#include "dense_grid_sir_rule.hpp"
+
+using namespace cadmium::celldevs;
+using namespace cadmium::celldevs::example::sir;
+
+std::shared_ptr<DenseGridRule<SIRState, double>> addDenseGridRule(const std::shared_ptr<const GridCellConfig<SIRState, double>>& cellConfig) {
+	auto cellModel = cellConfig->cellModel;
+	if (cellModel == "default" || cellModel == "SIR") {
+		return std::make_shared<DenseGridSIRRule>(cellConfig);
+	} else {
+		throw std::bad_typeid();
+	}
+}
+
+int main(int argc, char ** argv) {
+	if (argc < 2) {
+		std::cout << "Program used with wrong parameters. The program must be invoked as follows:";
+		std::cout << argv[0] << " SCENARIO_CONFIG.json [MAX_SIMULATION_TIME (default: 500)] [LOG (default: 1)]" << std::endl;
+		return -1;
+	}
+	std::string configFilePath = argv[1];
+	double simTime = (argc > 2)? std::stod(argv[2]) : 500;
+	bool log = (argc > 3)? std::stoi(argv[3]) != 0 : true;
+	auto paramsProcessed = std::chrono::high_resolution_clock::now();
+
+	auto model = DenseGridCellDEVS<SIRState, double>("sir", addDenseGridRule, configFilePath);
+	model.buildModel();
+	auto modelGenerated = std::chrono::high_resolution_clock::now();
+	std::cout << "Model creation time: " << std::chrono::duration_cast<std::chrono::duration<double, std::ratio<1>>>( modelGenerated - paramsProcessed).count() << " seconds" << std::endl;
+
+	if (log) {
+		model.setLogger(std::make_shared<cadmium::CSVLogger>("dense_grid_log.csv", ";"));
+	}
+	model.start();
+	std::cout << "Number of threads: " << omp_get_max_threads() << std::endl;
+	auto engineStarted = std::chrono::high_resolution_clock::now();
+	model.simulate(simTime);
+	auto simulationDone =  std::chrono::high_resolution_clock::now();
+	std::cout << "Simulation time: " << std::chrono::duration_cast<std::chrono::duration<double, std::ratio<1>>>(simulationDone - engineStarted).count() << " seconds" << std::endl;
+	model.stop();
+}
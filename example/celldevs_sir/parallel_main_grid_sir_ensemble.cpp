@@ -0,0 +1,78 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#include <cadmium/celldevs/grid/coupled.hpp>
+#include <cadmium/core/simulation/ensemble.hpp>
+#include <chrono>
+#include <nlohmann/json.hpp>
+#include <string>
+#include "grid_sir_cell.hpp"
+
+using namespace cadmium::celldevs;
+using namespace cadmium::celldevs::example::sir;
+
+constexpr double VIR_MIN = 0.2;  //!< Virulence factor of the first replication.
+constexpr double VIR_MAX = 0.6;  //!< Virulence factor of the last replication.
+
+std::shared_ptr<GridCell<SIRState, double, 2>> addGridCell(const gridCoordinates<2> & cellId, const std::shared_ptr<const GridCellConfig<SIRState, double, 2>>& cellConfig) {
+	auto cellModel = cellConfig->cellModel;
+	if (cellModel == "default" || cellModel == "SIR") {
+		return std::make_shared<GridSIRCell>(cellId, cellConfig);
+	} else {
+		throw std::bad_typeid();
+	}
+}
+
+int main(int argc, char ** argv) {
+	if (argc < 3) {
+		std::cout << "Program used with wrong parameters. The program must be invoked as follows:";
+		std::cout << argv[0] << " SCENARIO_CONFIG.json N_REPLICATIONS [MAX_SIMULATION_TIME (default: 500)]" << std::endl;
+		return -1;
+	}
+	std::string configFilePath = argv[1];
+	int nReplications = std::stoi(argv[2]);
+	double simTime = (argc > 3)? std::stod(argv[3]) : 500;
+	auto paramsProcessed = std::chrono::high_resolution_clock::now();
+
+	// Every replication simulates a different virulence factor, evenly spaced between VIR_MIN and VIR_MAX
+	auto virulence = [nReplications](std::size_t i) {
+		return (nReplications < 2) ? VIR_MIN : VIR_MIN + (VIR_MAX - VIR_MIN) * (double) i / (nReplications - 1);
+	};
+	// The configuration file is parsed and the topology of the scenario is computed only once.
+	// Replications share them, and only load again the cell configurations with their own virulence factor
+	auto prototype = std::make_shared<GridCellDEVSCoupled<SIRState, double, 2>>("sir", addGridCell, configFilePath);
+	prototype->buildCells();
+	auto modelFactory = [&prototype, &virulence](std::size_t i) -> std::shared_ptr<cadmium::Coupled> {
+		nlohmann::json patch = {{"default", {{"config", {{"vir", virulence(i)}}}}}};
+		auto model = std::make_shared<GridCellDEVSCoupled<SIRState, double, 2>>("sir", *prototype, patch);
+		model->buildModel();
+		return model;
+	};
+	// The result of each replication is the final number of infected people
+	auto infected = [](std::size_t, const std::shared_ptr<cadmium::Coupled>& model) {
+		double res = 0;
+		for (const auto& [cellId, cell]: model->getComponents()) {
+			const auto& state = std::dynamic_pointer_cast<GridCell<SIRState, double, 2>>(cell)->getState();
+			res += state.i * state.p;
+		}
+		return res;
+	};
+	auto ensemble = cadmium::Ensemble<double>(modelFactory, infected, nReplications);
+	auto modelGenerated = std::chrono::high_resolution_clock::now();
+	std::cout << "Model creation time: " << std::chrono::duration_cast<std::chrono::duration<double, std::ratio<1>>>( modelGenerated - paramsProcessed).count() << " seconds" << std::endl;
+
+	modelGenerated = std::chrono::high_resolution_clock::now();
+	auto results = ensemble.simulate(simTime);
+	auto simulationDone =  std::chrono::high_resolution_clock::now();
+	std::cout << "Simulation time: " << std::chrono::duration_cast<std::chrono::duration<double, std::ratio<1>>>(simulationDone - modelGenerated).count() << " seconds" << std::endl;
+
+	double mean = 0;
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		std::cout << "Replication " << i << " (virulence " << virulence(i) << "): " << results[i] << " infected people" << std::endl;
+		mean += results[i] / (double) results.size();
+	}
+	std::cout << "Mean: " << mean << " infected people" << std::endl;
+}
@@ -31,11 +31,31 @@ namespace cadmium::example::devstone {
 	std::ostream &operator << (std::ostream &os, const DEVStoneAtomicState& x);
 
 	//! DEVStone atomic DEVS model
-	class DEVStoneAtomic: public Atomic<DEVStoneAtomicState> {
+	class DEVStoneAtomic final: public Atomic<DEVStoneAtomicState> {
 	 private:
 		const int intDelay;   //!< Dhrystone execution time (in ms) when triggering the internal transition function.
 		const int  extDelay;  //!< Dhrystone execution time (in ms) when triggering the external transition function.
 	 public:
+		using Atomic<DEVStoneAtomicState>::confluentTransition;
+
+		// Overrides of the methods of AtomicInterface. As the class is final, they call the functions below directly
+		// when parallel coordinators register the type (see ParallelRootCoordinator::registerAtomicType).
+		void internalTransition() override {
+			internalTransition(state);
+		}
+
+		void externalTransition(double e) override {
+			externalTransition(state, e);
+		}
+
+		void output() override {
+			output(state);
+		}
+
+		[[nodiscard]] double timeAdvance() const override {
+			return timeAdvance(state);
+		}
+
 		Port<int> in;   //!< Input Port.
 		Port<int> out;  //!< Output Port.
 
@@ -9,6 +9,7 @@
 #include <chrono>
 #include <iostream>
 #include <string>
+#include "include/devstone_atomic.hpp"
 #include "include/devstone_coupled.hpp"
 #include <cadmium/core/simulation/parallel_root_coordinator.hpp>
 
@@ -49,6 +50,7 @@ int main(int argc, char *argv[]) {
 	// Then, we inject initial events and create and start the simulation engine
 	modelGenerated = std::chrono::high_resolution_clock::now();
 	auto rootCoordinator = cadmium::ParallelRootCoordinator(coupled);
+	rootCoordinator.registerAtomicType<DEVStoneAtomic>();  // All the atomic models of DEVStone are of the same type
 	rootCoordinator.start();
 	auto engineStarted = std::chrono::high_resolution_clock::now();
 	std::cout << "Engine creation time: " << std::chrono::duration_cast<std::chrono::duration<double, std::ratio<1>>>(engineStarted - modelGenerated).count() << " seconds" << std::endl;
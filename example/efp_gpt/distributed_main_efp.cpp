@@ -0,0 +1,57 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#include <cadmium/core/logger/csv.hpp>
+#include <cadmium/core/simulation/distributed_root_coordinator.hpp>
+#include <cadmium/core/transport/unix_socket.hpp>
+#include <iostream>
+#include <limits>
+#include <string>
+#include "efp.hpp"
+
+using namespace cadmium::example::gpt;
+
+int main(int argc, char *argv[]) {
+    // First, we parse the arguments
+    if (argc < 5) {
+        std::cerr << "ERROR: not enough arguments" << std::endl;
+        std::cerr << "    Usage:" << std::endl;
+        std::cerr << "    > distributed_main_efp JOB_GENERATION_PERIOD JOB_PROCESSING_TIME OBSERVATION_TIME N_PROCESSES" << std::endl;
+        std::cerr << "        (JOB_GENERATION_PERIOD, JOB_PROCESSING_TIME, and OBSERVATION_TIME must be greater than or equal to 0)" << std::endl;
+        std::cerr << "        (N_PROCESSES must be greater than 0)" << std::endl;
+        return -1;
+    }
+    int jobPeriod = std::stoi(argv[1]);
+    if (jobPeriod < 0) {
+        std::cerr << "ERROR: JOB_GENERATION_PERIOD is less than 0 (" << jobPeriod << ")" << std::endl;
+        return -1;
+    }
+    int processingTime = std::stoi(argv[2]);
+    if (processingTime < 0) {
+        std::cerr << "ERROR: JOB_PROCESSING_TIME is less than 0 (" << processingTime << ")" << std::endl;
+        return -1;
+    }
+    double obsTime = std::stod(argv[3]);
+    if (obsTime < 0) {
+        std::cerr << "ERROR: OBSERVATION_TIME is less than 0 (" << obsTime << ")" << std::endl;
+        return -1;
+    }
+    int nProcesses = std::stoi(argv[4]);
+    if (nProcesses < 1) {
+        std::cerr << "ERROR: N_PROCESSES is less than 1 (" << nProcesses << ")" << std::endl;
+        return -1;
+    }
+    // Then, we create the processes. Each process builds the same model and simulates a part of it
+    auto transport = cadmium::UnixSocketTransport::fork(nProcesses);
+    auto model = std::make_shared<EFP>("efp", jobPeriod, processingTime, obsTime);
+    auto rootCoordinator = cadmium::DistributedRootCoordinator(model, transport);
+    auto logger = std::make_shared<cadmium::CSVLogger>("log_efp_" + std::to_string(transport->getRank()) + ".csv", ";");
+    rootCoordinator.setLogger(logger);
+    rootCoordinator.start();
+    rootCoordinator.simulate(std::numeric_limits<double>::infinity());
+    rootCoordinator.stop();
+    return 0;
+}
@@ -101,6 +101,14 @@ namespace cadmium::example::gpt {
 		[[nodiscard]] double timeAdvance(const ProcessorState& s) const override {
 			return s.sigma;
 		}
+
+		/**
+		 * New jobs are processed after ProcessorState::processingTime, and the processor ignores new jobs while busy.
+		 * @return the processing time of the processor.
+		 */
+		[[nodiscard]] double lookahead() const override {
+			return processingTime;
+		}
 	};
 }  //namespace cadmium::example::gpt
 
@@ -13,6 +13,8 @@
 #include <nlohmann/json.hpp>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 #include "../core/config.hpp"
 #include "../core/utility.hpp"
 
@@ -25,13 +27,19 @@ namespace cadmium::celldevs {
 	template<typename S, typename V>
 	struct AsymmCellConfig : public CellConfig<std::string, S, V> {
 		using CellConfig<std::string, S, V>::rawNeighborhood;
+		std::unordered_map<std::string, NeighborData<S, V>> neighborhood;  //!< Neighborhood of the cells with this configuration.
 
 		/**
 		 * Creates a new asymmetric cell configuration structure from a JSON object.
 		 * @param configId ID of the cell configuration structure.
 		 * @param configParams JSON object containing all the cell configuration parameters.
 		 */
-		AsymmCellConfig(const std::string& configId, const nlohmann::json& configParams) : CellConfig<std::string, S, V>(configId, configParams) {}
+		AsymmCellConfig(const std::string& configId, const nlohmann::json& configParams) : CellConfig<std::string, S, V>(configId, configParams),
+		  neighborhood() {
+			if (!rawNeighborhood.is_null()) {
+				neighborhood = rawNeighborhood.template get<std::unordered_map<std::string, NeighborData<S, V>>>();
+			}
+		}
 
 		/**
 		 * It builds a neighborhood set for a given cell in the scenario.
@@ -40,7 +48,21 @@ namespace cadmium::celldevs {
 		 * @return unordered map {neighbor cell ID: neighbor cell data}.
 		 */
 		std::unordered_map<std::string, NeighborData<S, V>> buildNeighborhood(const std::string& cellId) const override {
-			return rawNeighborhood.template get<std::unordered_map<std::string, NeighborData<S, V>>>();
+			return neighborhood;
+		}
+
+		/**
+		 * It builds the flat neighborhood set for a given cell in the scenario.
+		 * Cells share the vicinity factors of the configuration.
+		 * @param cellId ID of the cell that will own the neighborhood set.
+		 * @return vector of pairs {neighbor cell ID, pointer to the vicinity factor of the neighbor cell}.
+		 */
+		std::vector<std::pair<std::string, const V*>> buildNeighbors(const std::string&) const override {
+			std::vector<std::pair<std::string, const V*>> neighbors;
+			for (const auto& [neighbor, data]: neighborhood) {
+				neighbors.emplace_back(neighbor, &data.vicinity);
+			}
+			return neighbors;
 		}
 	};
 } // namespace cadmium::celldevs
@@ -42,6 +42,18 @@ namespace cadmium::celldevs {
 		  CellDEVSCoupled<std::string, S, V>(id, configFilePath), factory(factory) {}
 
 		/**
+		 * Constructor function for replicating an asymmetric Cell-DEVS model.
+		 * The new model shares the cell factory and the cell configurations of the prototype.
+		 * Call buildCells() on the prototype first, so replicas do not load the cell configurations nor compute
+		 * the topology again (see CellDEVSCoupled). Replicas may patch the parameters of the cell configurations.
+		 * @param id ID of the new coupled asymmetric Cell-DEVS model.
+		 * @param prototype asymmetric Cell-DEVS model to be replicated.
+		 * @param patch patch to be applied to the cell configurations of the prototype (JSON object). By default, it is empty.
+		 */
+		AsymmCellDEVSCoupled(const std::string& id, const AsymmCellDEVSCoupled<S, V>& prototype, const nlohmann::json& patch = nlohmann::json::object()):
+		  CellDEVSCoupled<std::string, S, V>(id, prototype, patch), factory(prototype.factory) {}
+
+		/**
 	     * Generates a cell configuration struct from a JSON object.
 		 * @param configId ID of the configuration to be loaded.
 		 * @param cellConfig cell configuration parameters (JSON object).
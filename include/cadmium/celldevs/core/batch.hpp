@@ -0,0 +1,192 @@
+/**
+ * Cells that simulate several replications of a Cell-DEVS scenario at once.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CELLDEVS_CORE_BATCH_HPP_
+#define CADMIUM_CELLDEVS_CORE_BATCH_HPP_
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "cell.hpp"
+#include "msg.hpp"
+#include "../../core/exception.hpp"
+#include "../../core/modeling/time.hpp"
+
+namespace cadmium::celldevs {
+	/**
+	 * @brief Base struct for batch cell states.
+	 *
+	 * Batch states contain the states of K replications (lanes) of a cell. They should be stored in
+	 * structure-of-arrays form (e.g., one std::array<double, K> per state variable), so local computations
+	 * can be vectorized across lanes. Batch states must also provide the following methods:
+	 *   - void copyLane(const B& from, std::size_t lane): it copies one lane of another batch state.
+	 *   - bool laneDiffers(const B& other, std::size_t lane) const: it returns true if one lane of both states differs.
+	 * As any other cell state, they must also implement the != operator.
+	 * @tparam K number of lanes.
+	 */
+	template <std::size_t K>
+	struct BatchState {
+		static constexpr std::size_t lanes = K;  //!< Number of lanes.
+		std::bitset<K> mask;                     //!< Active lanes. In messages, lanes that carry a new state.
+
+		BatchState(): mask() {}
+	};
+
+	/**
+	 * @brief Cell that simulates several replications of the same cell at once.
+	 *
+	 * All the replications share the topology of the scenario, but each lane evolves on its own. Local computations
+	 * receive a copy of the batch state with the mask of the lanes that received new neighbor states. They can compute
+	 * all the lanes at once (e.g., with OpenMP SIMD loops), as lanes that were not active are restored afterwards.
+	 * Each lane keeps its own inertial output schedule, and messages only carry the lanes that must be output.
+	 * Thus, every lane reproduces exactly the behavior of a regular cell with inertial delay.
+	 * @tparam C the type used for representing a cell ID.
+	 * @tparam B the type used for representing a batch cell state.
+	 * @tparam V the type used for representing a neighboring cell's vicinities.
+	 * @tparam T the type used for representing the simulation time. By default, it is double.
+	 * @tparam BaseCell base cell class (e.g., Cell<C, B, V, T> or GridCell<B, V>). Its time type must be T.
+	 */
+	template <typename C, typename B, typename V, typename T = double, typename BaseCell = Cell<C, B, V, T>>
+	class BatchCell: public BaseCell {
+		static_assert(std::is_base_of_v<BasicAtomicInterface<T>, BaseCell>, "the time type of the base cell must be T");
+	 public:
+		static constexpr std::size_t K = B::lanes;  //!< Number of lanes.
+		using LaneMask = std::bitset<K>;            //!< Bit mask of lanes.
+	 protected:
+		using BaseCell::id;
+		using BaseCell::state;
+		using BaseCell::neighborStates;
+		using BaseCell::clock;
+		using BaseCell::sigma;
+		using BaseCell::inputNeighborhood;
+		using BaseCell::outputNeighborhood;
+		B pending;                   //!< Lanes of the cell state that are waiting to be output.
+		std::array<T, K> next;       //!< Clock time at which each lane must output its pending state.
+		LaneMask received;           //!< Lanes that received new neighbor states since the last external transition.
+
+		//! @return the clock time of the next output of any lane.
+		[[nodiscard]] T nextOutput() const {
+			auto res = TimeTraits<T>::infinity();
+			for (auto t: next) {
+				res = std::min(res, t);
+			}
+			return res;
+		}
+
+		//! @return mask of the lanes that must output their pending state in the next output.
+		[[nodiscard]] LaneMask imminentLanes() const {
+			LaneMask res;
+			auto t = nextOutput();
+			for (std::size_t k = 0; k < K; ++k) {
+				res[k] = next[k] == t && t < TimeTraits<T>::infinity();
+			}
+			return res;
+		}
+	 public:
+		/**
+		 * Constructor function. Arguments are forwarded to the base cell class.
+		 * As regular cells, all the lanes output their initial state at the beginning of the simulation.
+		 * @throw CadmiumModelException if the delay type of the cell is not inertial.
+		 */
+		template <typename... Args>
+		explicit BatchCell(Args&&... args): BaseCell(std::forward<Args>(args)...), pending(state), next(), received() {
+			if (this->getCellConfig()->delayType != "inertial") {
+				throw CadmiumModelException("batch cells only support inertial delays");
+			}
+			pending.mask.set();
+		}
+
+		/**
+		 * Output delay function for a single lane. Its arguments are the new batch state and the lane of the new state.
+		 * By default, it calls the output delay function of the batch.
+		 * @return simulation time to wait before outputting the new state of the lane.
+		 */
+		[[nodiscard]] virtual T outputDelay(const B& s, std::size_t) const {
+			return this->outputDelay(s);
+		}
+		using BaseCell::outputDelay;
+
+		/**
+		 * It merges the lanes carried by a new neighbor state into the latest known state of the neighbor.
+		 * @param slot slot of the neighboring cell in the flat neighborhood set.
+		 * @param neighborState new state of the neighboring cell. Only the lanes in its mask are valid.
+		 */
+		void setNeighborState(std::size_t slot, std::shared_ptr<const B> neighborState) override {
+			const auto * current = neighborStates[slot].get();
+			const auto& lanes = neighborState->mask;
+			received |= lanes;
+			if (current == nullptr || lanes.all()) {
+				BaseCell::setNeighborState(slot, std::move(neighborState));
+			} else {
+				auto merged = std::make_shared<B>(*current);
+				for (std::size_t k = 0; k < K; ++k) {
+					if (lanes[k]) {
+						merged->copyLane(*neighborState, k);
+					}
+				}
+				BaseCell::setNeighborState(slot, std::move(merged));
+			}
+		}
+
+		//! The internal transition function removes the pending states of the imminent lanes.
+		void internalTransition() override {
+			auto imminent = imminentLanes();
+			clock += sigma;
+			for (std::size_t k = 0; k < K; ++k) {
+				if (imminent[k]) {
+					next[k] = TimeTraits<T>::infinity();
+				}
+			}
+			sigma = nextOutput() - clock;
+		}
+
+		/**
+		 * The external transition function merges the lanes carried by the input messages into the neighborhood.
+		 * Then, it computes the next state of the lanes that received new neighbor states.
+		 * Lanes whose state changes schedule a new output.
+		 * @param e elapsed time from the last event.
+		 */
+		void externalTransition(T e) override {
+			clock += e;
+			for (const auto& msg: inputNeighborhood->getBag()) {
+				setNeighborState(this->neighborSlot(*msg), msg->state);
+			}
+			auto active = received;
+			received.reset();
+			auto nextState = state;
+			nextState.mask = active;
+			nextState = this->localComputation(nextState, this->getNeighbors());
+			nextState.mask.reset();
+			for (std::size_t k = 0; k < K; ++k) {
+				if (!active[k]) {
+					nextState.copyLane(state, k);
+				} else if (nextState.laneDiffers(state, k)) {
+					pending.copyLane(nextState, k);
+					next[k] = clock + outputDelay(nextState, k);
+				}
+			}
+			state = nextState;
+			sigma = nextOutput() - clock;
+		}
+
+		//! The output function outputs the pending states of the imminent lanes through the outputNeighborhood port.
+		void output() override {
+			auto imminent = imminentLanes();
+			if (imminent.any()) {
+				auto msg = std::make_shared<B>(pending);
+				msg->mask = imminent;
+				outputNeighborhood->addMessage(CellStateMessage<C, B>(id, msg, this->index));
+			}
+		}
+	};
+} // namespace cadmium::celldevs
+
+#endif // CADMIUM_CELLDEVS_CORE_BATCH_HPP_
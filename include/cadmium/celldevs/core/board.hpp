@@ -0,0 +1,245 @@
+/**
+ * Root coordinator for Cell-DEVS models that exchanges neighbor states through a shared board.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CELLDEVS_CORE_BOARD_HPP_
+#define CADMIUM_CELLDEVS_CORE_BOARD_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "cell.hpp"
+#include "coupled.hpp"
+#include "msg.hpp"
+#include "../../core/exception.hpp"
+#include "../../core/logger/logger.hpp"
+#include "../../core/modeling/port.hpp"
+#include "../../core/modeling/time.hpp"
+#include "../../core/simulation/calendar_queue.hpp"
+
+namespace cadmium::celldevs {
+	/**
+	 * @brief Root coordinator for Cell-DEVS models that exchanges neighbor states through a shared board.
+	 *
+	 * Cells are not coupled. Instead, the states output by the cells are published in a board with one entry per cell.
+	 * The board is double-buffered: in every simulation step, the outputs of the imminent cells are first staged in a
+	 * list of changed cells. Then, they are published all at once, and only the cells that have a changed cell in their
+	 * neighborhood are woken up. Woken cells read the published state of their changed neighbors directly from the board.
+	 * Thus, the model does not store one coupling per neighbor, and output messages are not propagated through ports.
+	 * Simulations are equivalent to those of regular coordinators. Next times are kept in a calendar queue.
+	 * External couplings are not supported.
+	 * @tparam C the type used for representing a cell ID.
+	 * @tparam S the type used for representing a cell state.
+	 * @tparam V the type used for representing a neighboring cell's vicinities.
+	 * @tparam T the type used for representing the simulation time. By default, it is double.
+	 */
+	template <typename C, typename S, typename V, typename T = double>
+	class CellDEVSBoardRootCoordinator {
+	 private:
+		using Reader = std::pair<std::size_t, std::size_t>;  //!< Pair <index of a cell, slot of the neighbor in the cell>.
+
+		std::shared_ptr<CellDEVSCoupled<C, S, V>> model;                     //!< Pointer to the Cell-DEVS model.
+		std::vector<std::shared_ptr<Cell<C, S, V, T>>> cells;                //!< Cells of the model sorted by index.
+		std::vector<Port<std::shared_ptr<const CellStateMessage<C, S>>>> outPorts;  //!< Output port of every cell.
+		std::vector<std::vector<Reader>> readers;                            //!< For every cell, the cells that read its state.
+		std::vector<std::shared_ptr<const S>> board;                         //!< Latest state published by every cell.
+		std::vector<std::pair<std::size_t, std::shared_ptr<const S>>> changes;  //!< States staged in the current step.
+		std::vector<T> timeLasts;                                            //!< Time of the last transition of every cell.
+		CalendarQueue<T> queue;                                              //!< Calendar queue with the next time of every cell.
+		T timeLast;                                                          //!< Time of the last simulation step.
+		std::shared_ptr<Logger> logger;                                      //!< Pointer to simulation logger.
+		std::vector<std::size_t> imminent;                                   //!< Buffer with the imminent cells of a step.
+		std::vector<std::size_t> active;                                     //!< Buffer with the cells that change in a step.
+		std::vector<char> flags;                                             //!< For every cell, its role in the current step.
+
+		static constexpr char IMMINENT = 1;  //!< Flag of cells that output their state in the current step.
+		static constexpr char RECEIVER = 2;  //!< Flag of cells that read new neighbor states in the current step.
+
+		/**
+		 * It adds a role to a cell. Cells are added to the active buffer the first time they get a role.
+		 * @param cell index of the cell.
+		 * @param role role of the cell (IMMINENT or RECEIVER).
+		 */
+		void activate(std::size_t cell, char role) {
+			if (flags[cell] == 0) {
+				active.push_back(cell);
+			}
+			flags[cell] |= role;
+		}
+
+		/**
+		 * It logs the state of a cell.
+		 * @param time current simulation time.
+		 * @param cell index of the cell.
+		 */
+		void logState(T time, std::size_t cell) {
+			logger->logState(TimeTraits<T>::toDouble(time), static_cast<long>(cell), cells[cell]->getId(), cells[cell]->logState());
+		}
+
+		/**
+		 * It runs a simulation step.
+		 * @param time simulation time of the step. It must be the time of the next events of the calendar queue.
+		 */
+		void simulationAdvance(T time) {
+			if (logger != nullptr) {
+				logger->logTime(TimeTraits<T>::toDouble(time));
+			}
+			imminent.clear();
+			active.clear();
+			queue.pop(imminent);
+			std::sort(imminent.begin(), imminent.end());
+			// Output: imminent cells stage their output in the back buffer
+			for (auto cell: imminent) {
+				activate(cell, IMMINENT);
+				static_cast<BasicAtomicInterface<T>&>(*cells[cell]).output();
+				const auto& port = outPorts[cell];
+				for (std::size_t i = 0; i < port->size(); ++i) {
+					changes.emplace_back(cell, port->getBag()[i]->state);
+					if (logger != nullptr) {
+						logger->logOutput(TimeTraits<T>::toDouble(time), static_cast<long>(cell), cells[cell]->getId(), port->getId(), port->logMessage(i));
+					}
+				}
+				port->clear();
+			}
+			// Publication: staged states are published, and their readers are woken up
+			for (auto& [cell, state]: changes) {
+				board[cell] = std::move(state);
+				for (const auto& [reader, slot]: readers[cell]) {
+					cells[reader]->setNeighborState(slot, board[cell]);
+					activate(reader, RECEIVER);
+				}
+			}
+			changes.clear();
+			// Transition: cells run the transition that corresponds to their role
+			std::sort(active.begin(), active.end());
+			for (auto cell: active) {
+				auto& atomic = static_cast<BasicAtomicInterface<T>&>(*cells[cell]);
+				if (flags[cell] == IMMINENT) {
+					atomic.internalTransition();
+				} else if (flags[cell] == RECEIVER) {
+					atomic.externalTransition(time - timeLasts[cell]);
+				} else {
+					atomic.confluentTransition(time - timeLasts[cell]);
+				}
+				flags[cell] = 0;
+				timeLasts[cell] = time;
+				queue.schedule(cell, time + atomic.timeAdvance());
+				if (logger != nullptr) {
+					logState(time, cell);
+				}
+			}
+			timeLast = time;
+		}
+	 public:
+		/**
+		 * Constructor function. The Cell-DEVS model must contain all its cells, but it does not need any coupling.
+		 * Build the model with CellDEVSCoupled::buildCells() to avoid creating couplings that are not used.
+		 * @param model pointer to the Cell-DEVS model.
+		 * @param width width of the buckets of the calendar queue. By default, it is 1.
+		 * @throw CadmiumModelException if the model has no cells, if cells are not indexed, or if a cell has external couplings.
+		 */
+		explicit CellDEVSBoardRootCoordinator(std::shared_ptr<CellDEVSCoupled<C, S, V>> model, T width = T(1)):
+		  model(std::move(model)), cells(), outPorts(), readers(), board(), changes(), timeLasts(), queue(0, width, 1),
+		  timeLast(TimeTraits<T>::zero()), logger(), imminent(), active(), flags() {
+			for (const auto& cell: this->model->getCells()) {
+				auto cellModel = std::dynamic_pointer_cast<Cell<C, S, V, T>>(cell);
+				if (cellModel == nullptr) {
+					throw CadmiumModelException("Scenario component is not a cell");
+				}
+				const auto& config = cellModel->getCellConfig();
+				if (!config->EIC.empty() || !config->EOC.empty()) {
+					throw CadmiumModelException("board Cell-DEVS simulation does not support external couplings");
+				}
+				if (cellModel->getIndex() != cells.size() || cellModel->getRoutes().size() != cellModel->getNeighbors().size()) {
+					throw CadmiumModelException("Cell-DEVS model cells are not indexed");
+				}
+				outPorts.push_back(cellModel->template getOutPort<std::shared_ptr<const CellStateMessage<C, S>>>("outputNeighborhood"));
+				cells.push_back(std::move(cellModel));
+			}
+			if (cells.empty()) {
+				throw CadmiumModelException("Cell-DEVS model has no cells");
+			}
+			readers.resize(cells.size());
+			for (std::size_t i = 0; i < cells.size(); ++i) {
+				for (const auto& [neighbor, slot]: cells[i]->getRoutes()) {
+					readers[neighbor].emplace_back(i, slot);
+				}
+			}
+			board.resize(cells.size());
+			timeLasts.resize(cells.size(), timeLast);
+			flags.resize(cells.size());
+			queue = CalendarQueue<T>(cells.size(), width, cells.size());
+			for (std::size_t i = 0; i < cells.size(); ++i) {
+				queue.schedule(i, timeLast + static_cast<BasicAtomicInterface<T>&>(*cells[i]).timeAdvance());
+			}
+		}
+
+		//! @return number of cells of the model.
+		[[nodiscard]] std::size_t size() const {
+			return cells.size();
+		}
+
+		/**
+		 * @param cell index of a cell.
+		 * @return pointer to the cell.
+		 */
+		[[nodiscard]] const std::shared_ptr<Cell<C, S, V, T>>& getCell(std::size_t cell) const {
+			return cells.at(cell);
+		}
+
+		//! @return time of the last simulation step.
+		[[nodiscard]] T getTimeLast() const {
+			return timeLast;
+		}
+
+		/**
+		 * It sets the logger. Every cell is logged as a model whose ID is its index.
+		 * @param log pointer to the new logger.
+		 */
+		void setLogger(const std::shared_ptr<Logger>& log) {
+			logger = log;
+		}
+
+		void start() {
+			if (logger != nullptr) {
+				logger->start();
+				for (std::size_t cell = 0; cell < cells.size(); ++cell) {
+					logState(timeLast, cell);
+				}
+			}
+		}
+
+		void stop() {
+			if (logger != nullptr) {
+				for (std::size_t cell = 0; cell < cells.size(); ++cell) {
+					logState(timeLast, cell);
+				}
+				logger->stop();
+			}
+		}
+
+		[[maybe_unused]] void simulate(long nIterations) {
+			T timeNext = queue.nextTime();
+			while (nIterations-- > 0 && timeNext < TimeTraits<T>::infinity()) {
+				simulationAdvance(timeNext);
+				timeNext = queue.nextTime();
+			}
+		}
+
+		[[maybe_unused]] void simulate(T timeInterval) {
+			T timeNext = queue.nextTime();
+			T timeFinal = timeLast + timeInterval;
+			while (timeNext < timeFinal) {
+				simulationAdvance(timeNext);
+				timeNext = queue.nextTime();
+			}
+		}
+	};
+} // namespace cadmium::celldevs
+
+#endif // CADMIUM_CELLDEVS_CORE_BOARD_HPP_
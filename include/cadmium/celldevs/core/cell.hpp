@@ -10,11 +10,16 @@
 #ifndef CADMIUM_CELLDEVS_CORE_CELL_HPP_
 #define CADMIUM_CELLDEVS_CORE_CELL_HPP_
 
+#include <algorithm>
+#include <cstddef>
 #include <sstream>
 #include <memory>
+#include <stdexcept>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include "../../core/modeling/atomic.hpp"
+#include "../../core/exception.hpp"
 #include "config.hpp"
 #include "msg.hpp"
 #include "queue/queue.hpp"
@@ -23,52 +28,117 @@
 namespace cadmium::celldevs {
 	/**
 	 * @brief Abstract DEVS atomic model for defining cells in Cell-DEVS scenarios.
+	 *
+	 * If the active frontier of the cell configuration is enabled, cells only react to changes. They do not output a
+	 * state that is equal to the latest state they output, and they do not compute a new state if the neighbor states
+	 * they receive are equal to the ones they already knew. Thus, only the cells next to the cells that actually change
+	 * are activated. It is only equivalent to regular Cell-DEVS if the local computation function is idempotent (i.e.,
+	 * computing the state of a cell twice with the same neighborhood does not change it).
 	 * @tparam C the type used for representing a cell ID.
 	 * @tparam S the type used for representing a cell state.
 	 * @tparam V the type used for representing a neighboring cell's vicinities.
+	 * @tparam T the type used for representing the simulation time. By default, it is double.
 	 */
-	template <typename C, typename S, typename V>
-	class Cell: public AtomicInterface {
+	template <typename C, typename S, typename V, typename T = double>
+	class Cell: public BasicAtomicInterface<T> {
 	 protected:
-		const C id;                                                           //!< Cell ID
-		const std::shared_ptr<const CellConfig<C, S, V>> cellConfig;	      //!< Cell configuration parameters.
-		S state;                                                              //!< Cell state.
-		std::unordered_map<C, NeighborData<S, V>> neighborhood;               //!< Cell neighborhood set.
-		const std::unique_ptr<OutputQueue<S>> outputQueue;                    //!< Cell output queue ruled by a given delay type function.
-		double clock;                                                         //!< Simulation clock (i.e. current time during a simulation).
-		double sigma;                                                         //!< Time remaining until next internal state transition.
+		const C id;                                                                   //!< Cell ID
+		const std::shared_ptr<const CellConfig<C, S, V>> cellConfig;	              //!< Cell configuration parameters.
+		S state;                                                                      //!< Cell state.
+		mutable std::vector<std::shared_ptr<const S>> neighborStates;                 //!< Latest known state of every neighbor (one slot per neighbor).
+		mutable std::vector<const V*> neighborVicinities;                             //!< Vicinity factor of every neighbor. They are owned by the cell configuration.
+		mutable bool neighborsBuilt;                                                  //!< If true, the flat neighborhood set is already built.
+		std::vector<std::pair<std::size_t, std::size_t>> routes;                      //!< Pairs <neighbor index, slot> sorted by neighbor index.
+		std::size_t index;                                                            //!< Index of the cell within its Cell-DEVS model.
+		mutable std::unordered_map<C, NeighborData<S, V>> neighborhood;               //!< Cell neighborhood set. It is only built if required.
+		mutable std::vector<std::pair<const C, NeighborData<S, V>>*> neighborSlots;   //!< For each slot, pointer to the corresponding element of the neighborhood set.
+		const std::unique_ptr<OutputQueue<S, T>> outputQueue;                         //!< Cell output queue ruled by a given delay type function.
+		std::shared_ptr<const S> published;                                           //!< Latest state output by the cell. Only tracked with active frontiers.
+		bool neighborChanged;                                                         //!< If true, a neighbor state changed since the last external transition. Only tracked with active frontiers.
+		T clock;                                                                      //!< Simulation clock (i.e. current time during a simulation).
+		T sigma;                                                                      //!< Time remaining until next internal state transition.
 		BigPort<CellStateMessage<C, S>> inputNeighborhood;   //!< Cell input port. It receives new neighboring cells' state.
 		BigPort<CellStateMessage<C, S>> outputNeighborhood;  //!< cell output port. It outputs cell state changes.
+
+		/**
+		 * It builds the flat neighborhood set from the cell configuration if it was not built nor set before.
+		 * Cells of Cell-DEVS coupled models receive their flat neighborhood set when they are indexed (see setNeighbors()).
+		 */
+		void initNeighbors() const {
+			if (!neighborsBuilt) {
+				for (const auto& [neighbor, vicinity]: cellConfig->buildNeighbors(id)) {
+					neighborVicinities.push_back(vicinity);
+				}
+				neighborStates.resize(neighborVicinities.size());
+				neighborsBuilt = true;
+			}
+		}
 	 public:
 		/**
 		 * Creates a new cell for a Cell-DEVS model.
 		 * It adds the input and output ports used by cells to communicate with each other.
 		 * It also schedules a new message to be sent at t = 0 (i.e., at the beginning of the simulation).
+		 * The flat neighborhood set is not built until it is required or set by the Cell-DEVS model (see setNeighbors()).
 		 * @param id ID of the cell to be created.
 		 * @param config configuration parameters for creating the cell.
 		 */
 		Cell(const C& id, const std::shared_ptr<const CellConfig<C, S, V>>& cellConfig):
-		  AtomicInterface(cellId(id)), id(id), cellConfig(cellConfig), state(cellConfig->state), neighborhood(cellConfig->buildNeighborhood(id)),
-		  outputQueue(OutputQueue<S>::newOutputQueue(cellConfig->delayType)), clock(), sigma() {
-			inputNeighborhood = addInBigPort<CellStateMessage<C, S>>("inputNeighborhood");
-			outputNeighborhood = addOutBigPort<CellStateMessage<C, S>>("outputNeighborhood");
+		  BasicAtomicInterface<T>(cellId(id)), id(id), cellConfig(cellConfig), state(cellConfig->state),
+		  neighborStates(), neighborVicinities(), neighborsBuilt(), routes(), index(CellStateMessage<C, S>::noIndex), neighborhood(),
+		  neighborSlots(), outputQueue(OutputQueue<S, T>::newOutputQueue(cellConfig->delayType)), published(), neighborChanged(), clock(), sigma() {
+			inputNeighborhood = this->template addInBigPort<CellStateMessage<C, S>>("inputNeighborhood");
+			outputNeighborhood = this->template addOutBigPort<CellStateMessage<C, S>>("outputNeighborhood");
 			outputQueue->addToQueue(state, clock);
 		}
 
 		/**
 		 * Local computation function. It computes the new state of the cell.
+		 * Cells must override either this function or the one that receives a flat neighborhood set.
+		 * Its arguments are a copy of the current state of the cell and the neighborhood set of the cell
+		 * (unordered map {neighbor cell ID: neighbor cell data}).
+		 * @return new state of the cell.
+		 * @throw CadmiumModelException if the cell does not override any local computation function.
+		 */
+		virtual S localComputation(S, const std::unordered_map<C, NeighborData<S, V>>&) const {
+			throw CadmiumModelException("local computation function not implemented");
+		}
+
+		/**
+		 * Local computation function with a flat neighborhood set. It is the one called by the simulator.
+		 * Iterating over the flat neighborhood set is faster than iterating over the unordered map.
+		 * By default, it ignores the flat neighborhood set and calls the local computation function that receives the unordered map.
 		 * @param state copy of the current state of the cell.
-		 * @param neighborhood neighborhood set of the cell (unordered map {neighbor cell ID: neighbor cell data}).
 		 * @return new state of the cell.
 		 */
-		virtual S localComputation(S state, const std::unordered_map<C, NeighborData<S, V>>& neighborhood) const = 0;
+		virtual S localComputation(S state, NeighborSpan<S, V>) const {
+			return localComputation(std::move(state), getNeighborhood());
+		}
 
 		/**
 		 * Output delay function. It determines the time to wait before outputting a message with the new cell state.
 		 * @param state  new cell state.
 		 * @return simulation time to wait before outputting a message with the new cell state.
 		 */
-		virtual double outputDelay(const S& state) const = 0;
+		virtual T outputDelay(const S& state) const = 0;
+
+		/**
+		 * It checks if the output delay of the cell is the same for every state.
+		 * Its argument is set to the output delay if the output delay is constant.
+		 * By default, output delays are not constant, and the argument is not modified.
+		 * @return true if the output delay is constant.
+		 */
+		virtual bool constantDelay(T&) const {
+			return false;
+		}
+
+		/**
+		 * Cells do not output a new state before its output delay. Thus, a constant output delay is also the lookahead.
+		 * @return the constant output delay of the cell (if any). Otherwise, the default lookahead of atomic models.
+		 */
+		[[nodiscard]] T lookahead() const override {
+			T delay = TimeTraits<T>::zero();
+			return (constantDelay(delay)) ? delay : BasicAtomicInterface<T>::lookahead();
+		}
 
 		/**
 		 * Returns a string representation of a cell.
@@ -86,13 +156,143 @@ namespace cadmium::celldevs {
 			return cellConfig;
 		}
 
-		//! @return constant reference to cell neighborhood set.
+		//! @return constant reference to the current cell state.
+		const S& getState() const {
+			return state;
+		}
+
+		/**
+		 * It returns the neighborhood set of the cell as an unordered map. The map is built the first time it is required.
+		 * Then, it is kept up to date with the flat neighborhood set. Cells that only use the flat set never build it.
+		 * @return constant reference to cell neighborhood set.
+		 */
 		const std::unordered_map<C, NeighborData<S, V>>& getNeighborhood() const {
+			initNeighbors();
+			if (neighborSlots.size() != neighborStates.size()) {
+				auto neighbors = cellConfig->buildNeighbors(id);
+				neighborhood.reserve(neighbors.size());
+				for (std::size_t slot = 0; slot < neighbors.size(); ++slot) {
+					auto& neighbor = *neighborhood.emplace(neighbors[slot].first, NeighborData<S, V>(*neighbors[slot].second)).first;
+					neighbor.second.state = neighborStates[slot];
+					neighborSlots.push_back(&neighbor);
+				}
+			}
 			return neighborhood;
 		}
 
+		//! @return view of the flat cell neighborhood set.
+		NeighborSpan<S, V> getNeighbors() const {
+			initNeighbors();
+			return {neighborStates.data(), neighborVicinities.data(), neighborStates.size()};
+		}
+
+		//! @return constant reference to the cell ID.
+		const C& getCellId() const {
+			return id;
+		}
+
+		/**
+		 * It sets the index of the cell and the indices of its neighbors.
+		 * Messages from indexed neighbors are routed to their slot without hashing the neighbor ID.
+		 * @param cellIndex index of the cell within its Cell-DEVS model.
+		 * @param neighborIndices index of every neighbor, in the same order as in CellConfig::buildNeighbors.
+		 */
+		void setIndices(std::size_t cellIndex, const std::vector<std::size_t>& neighborIndices) {
+			initNeighbors();
+			if (neighborIndices.size() != neighborStates.size()) {
+				throw CadmiumModelException("number of neighbor indices does not match the neighborhood of cell " + this->getId());
+			}
+			index = cellIndex;
+			routes.clear();
+			for (std::size_t slot = 0; slot < neighborIndices.size(); ++slot) {
+				routes.emplace_back(neighborIndices[slot], slot);
+			}
+			std::sort(routes.begin(), routes.end());
+		}
+
+		/**
+		 * It sets the flat neighborhood set of the cell, so the cell does not build it from its configuration.
+		 * Then, it sets the index of the cell and the indices of its neighbors (see setIndices()).
+		 * If the flat neighborhood set is already built, vicinities must refer to the same number of neighbors.
+		 * @param cellIndex index of the cell within its Cell-DEVS model.
+		 * @param neighborIndices index of every neighbor, in the same order as in CellConfig::buildNeighbors.
+		 * @param vicinities pointer to the vicinity factor of every neighbor, in the same order as the indices.
+		 * @throw CadmiumModelException if the number of vicinities or neighbor indices does not match the neighborhood.
+		 */
+		void setNeighbors(std::size_t cellIndex, const std::vector<std::size_t>& neighborIndices, const std::vector<const V*>& vicinities) {
+			if (neighborsBuilt && vicinities.size() != neighborStates.size()) {
+				throw CadmiumModelException("number of vicinities does not match the neighborhood of cell " + this->getId());
+			}
+			neighborVicinities = vicinities;
+			neighborStates.resize(neighborVicinities.size());
+			neighborsBuilt = true;
+			setIndices(cellIndex, neighborIndices);
+		}
+
+		//! @return index of the cell within its Cell-DEVS model. If the cell is not indexed, it returns CellStateMessage::noIndex.
+		[[nodiscard]] std::size_t getIndex() const {
+			return index;
+		}
+
+		//! @return pairs <neighbor index, slot> of the indexed neighbors of the cell, sorted by neighbor index.
+		[[nodiscard]] const std::vector<std::pair<std::size_t, std::size_t>>& getRoutes() const {
+			return routes;
+		}
+
+		/**
+		 * It finds the slot of the neighbor that sent a message.
+		 * @param msg message sent by a neighboring cell.
+		 * @return slot of the neighboring cell in the flat neighborhood set.
+		 * @throw std::out_of_range if the sender of the message is not a neighbor of the cell.
+		 */
+		[[nodiscard]] std::size_t neighborSlot(const CellStateMessage<C, S>& msg) const {
+			initNeighbors();
+			if (msg.senderIndex != CellStateMessage<C, S>::noIndex) {
+				auto it = std::lower_bound(routes.begin(), routes.end(), std::make_pair(msg.senderIndex, std::size_t{0}));
+				if (it != routes.end() && it->first == msg.senderIndex) {
+					return it->second;
+				}
+			}
+			auto it = getNeighborhood().find(msg.cellId);
+			for (std::size_t slot = 0; it != neighborhood.end() && slot < neighborSlots.size(); ++slot) {
+				if (neighborSlots[slot] == &*it) {
+					return slot;
+				}
+			}
+			throw std::out_of_range("message sender is not a neighbor");
+		}
+
+		/**
+		 * It updates the latest known state of a neighboring cell.
+		 * It is called for every new neighbor state before the external transition that processes it.
+		 * With active frontiers, it also records whether the new state differs from the latest known state.
+		 * @param slot slot of the neighboring cell in the flat neighborhood set.
+		 * @param neighborState new state of the neighboring cell.
+		 */
+		virtual void setNeighborState(std::size_t slot, std::shared_ptr<const S> neighborState) {
+			if (cellConfig->activeFrontier && !neighborChanged) {
+				neighborChanged = neighborStates[slot] == nullptr || *neighborStates[slot] != *neighborState;
+			}
+			if (!neighborSlots.empty()) {
+				neighborSlots[slot]->second.state = neighborState;
+			}
+			neighborStates[slot] = std::move(neighborState);
+		}
+
+		/**
+		 * It checks if the cell must output a state. With active frontiers, cells do not output their latest output again.
+		 * @param nextState next state scheduled in the output queue.
+		 * @return true if the cell must output the state.
+		 */
+		[[nodiscard]] bool mustPublish(const std::shared_ptr<const S>& nextState) const {
+			return nextState != nullptr && (!cellConfig->activeFrontier || published == nullptr || *nextState != *published);
+		}
+
 		//! The internal transition function cleans the output queue and updates the clock and sigma.
 		void internalTransition() override {
+			if (cellConfig->activeFrontier && mustPublish(outputQueue->nextState())) {
+				published = outputQueue->nextState();
+			}
 			outputQueue->pop();
 			clock += sigma;
 			sigma = outputQueue->nextTime() - clock;
@@ -101,16 +301,22 @@ namespace cadmium::celldevs {
 		/**
 		 * The external transition function updates the clock and sigma.
 		 * Then, it refreshes the neighbors' state and computes the cell's next state.
+		 * With active frontiers, the next state is only computed if the state of a neighbor changed (see setNeighborState()).
 		 * If the new cell state is different to the current state, it schedules a new message using the output queue.
 		 * @param e elapsed time from the last event.
 		 */
-		void externalTransition(double e) override {
+		void externalTransition(T e) override {
 			clock += e;
 			sigma -= e;
 			for (auto const& msg: inputNeighborhood->getBag()) {
-				neighborhood.at(msg->cellId).state = msg->state;
+				setNeighborState(neighborSlot(*msg), msg->state);
+			}
+			auto changed = !cellConfig->activeFrontier || neighborChanged;
+			neighborChanged = false;
+			if (!changed) {
+				return;
 			}
-			auto nextState = localComputation(state, neighborhood);
+			auto nextState = localComputation(state, getNeighbors());
 			if (nextState != state) {
 				outputQueue->addToQueue(nextState, clock + outputDelay(nextState));
 				sigma = outputQueue->nextTime() - clock;
@@ -119,15 +325,15 @@ namespace cadmium::celldevs {
 		}
 
 		//! The time advance function always corresponds to the value of sigma.
-		[[nodiscard]] double timeAdvance() const override {
+		[[nodiscard]] T timeAdvance() const override {
 			return sigma;
 		}
 
-		//! The output function outputs the next state scheduled in the queue through the outputNeighborhood port.
+		//! The output function outputs the next state scheduled in the queue (if it must be published) through the outputNeighborhood port.
 		void output() override {
-			auto nextState = outputQueue->nextState();
-			if (nextState != nullptr) {
-				outputNeighborhood->addMessage(CellStateMessage<C, S>(id, nextState));
+			const auto& nextState = outputQueue->nextState();
+			if (mustPublish(nextState)) {
+				outputNeighborhood->addMessage(CellStateMessage<C, S>(id, nextState, index));
 			}
 		}
 
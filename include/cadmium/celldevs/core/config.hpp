@@ -11,6 +11,7 @@
 #define CADMIUM_CELLDEVS_CORE_CONFIG_HPP_
 
 #include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
 #include <string>
 #include <unordered_map>
@@ -31,10 +32,15 @@ namespace cadmium::celldevs {
 		std::string cellModel;                                 //!< ID of the cell model. By default, it is set to "default".
 		std::string delayType;                                 //!< ID of the delay type function used by the cell. By default, it is set to "inertial".
 		S state;                                               //!< Initial state of the cell. By default, it is set to the default S value.
+		bool activeFrontier;                                   //!< If true, cells ignore unchanged states (see Cell). By default, it is set to false.
 		nlohmann::json rawNeighborhood;                        //!< JSON file with information regarding neighborhoods. By default, it is set to an empty JSON object.
 		nlohmann::json rawCellConfig;                          //!< JSON file with additional configuration parameters. By default, it is set to an empty JSON object.
 		std::vector<std::pair<std::string, std::string>> EIC;  //!< pairs <port from, port to> that describe how to connect the outside world with the input of the cells.
 		std::vector<std::string> EOC;                          //!< pairs <port from, port to> that describe how to connect the output of the cells with the outside world.
+	 private:
+		mutable std::unordered_map<C, std::vector<std::pair<C, V>>> ownedNeighbors;  //!< Per-cell copies of the vicinities built by the fallback buildNeighbors.
+		mutable std::mutex ownedNeighborsMutex;                                      //!< Mutex for building neighbors from several threads.
+	 public:
 
 		virtual ~CellConfig() = default;
 
@@ -45,15 +51,46 @@ namespace cadmium::celldevs {
 		 */
 		virtual std::unordered_map<C, NeighborData<S, V>> buildNeighborhood(const C& cellId) const = 0;
 
+		/**
+		 * It builds the flat neighborhood set of a given cell in the scenario.
+		 * Vicinity factors are owned by the configuration, so cells only keep pointers to them.
+		 * NOTE: the default implementation is only a fallback for configurations that do not know their vicinity
+		 * factors beforehand. It stores a copy of the neighborhood returned by buildNeighborhood for every cell that
+		 * requires it, and the copies are kept for the whole lifetime of the configuration (cells and topologies of
+		 * Cell-DEVS models point to them). Thus, it is not a flyweight: configurations whose cells share their vicinity
+		 * factors (e.g., GridCellConfig and AsymmCellConfig) override it and return pointers to the shared factors.
+		 * Further calls for the same cell return the same neighbors in the same order, and it is safe to call it from
+		 * several threads.
+		 * @param cellId ID of the cell that will own the neighborhood set.
+		 * @return vector of pairs {neighbor cell ID, pointer to the vicinity factor of the neighbor cell}.
+		 */
+		virtual std::vector<std::pair<C, const V*>> buildNeighbors(const C& cellId) const {
+			std::lock_guard<std::mutex> lock(ownedNeighborsMutex);
+			auto it = ownedNeighbors.find(cellId);
+			if (it == ownedNeighbors.end()) {
+				std::vector<std::pair<C, V>> owned;
+				for (const auto& [neighbor, data]: buildNeighborhood(cellId)) {
+					owned.emplace_back(neighbor, data.vicinity);
+				}
+				it = ownedNeighbors.emplace(cellId, std::move(owned)).first;
+			}
+			std::vector<std::pair<C, const V*>> neighbors;
+			for (const auto& [neighbor, vicinity]: it->second) {
+				neighbors.emplace_back(neighbor, &vicinity);
+			}
+			return neighbors;
+		}
+
 		/**
 		 * Creates a new cell configuration structure from a JSON object.
 		 * @param configId ID of the cell configuration structure.
 		 * @param configParams JSON object containing all the cell configuration parameters.
 		 */
-		CellConfig(std::string  configId, const nlohmann::json& configParams): configId(std::move(configId)), EIC(), EOC() {
+		CellConfig(std::string  configId, const nlohmann::json& configParams): configId(std::move(configId)), EIC(), EOC(), ownedNeighbors(), ownedNeighborsMutex() {
 			cellModel = (configParams.contains("model"))? configParams["model"].get<std::string>() : "default";
 			delayType = (configParams.contains("delay"))? configParams["delay"].get<std::string>() : "inertial";
 			state = (configParams.contains("state"))? configParams["state"].get<S>() : S();
+			activeFrontier = configParams.contains("active_frontier") && configParams["active_frontier"].get<bool>();
 			rawNeighborhood = (configParams.contains("neighborhood"))? configParams["neighborhood"] : nlohmann::json();
 			rawCellConfig = (configParams.contains("config")) ? configParams["config"] : nlohmann::json();
 			if (configParams.contains("eic")) {
@@ -10,13 +10,17 @@
 #ifndef CADMIUM_CELLDEVS_CORE_COUPLED_HPP_
 #define CADMIUM_CELLDEVS_CORE_COUPLED_HPP_
 
+#include <algorithm>
+#include <cstddef>
 #include <fstream>
+#include <memory>
 #include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include "cell.hpp"
 #include "config.hpp"
 #include "../../core/modeling/coupled.hpp"
@@ -32,14 +36,48 @@ namespace cadmium::celldevs {
 	template<typename C, typename S, typename V>
 	class CellDEVSCoupled : public Coupled {
 	 protected:
+		//! Topology of a Cell-DEVS model. Replicas share the topology of their prototype, so they do not compute it again.
+		struct Topology {
+			std::vector<C> cellIds;                                             //!< ID of every cell in simulation order.
+			std::vector<std::vector<std::size_t>> neighborIndices;              //!< Index of the neighbors of every cell, in CellConfig::buildNeighbors order.
+			std::vector<std::vector<const V*>> neighborVicinities;              //!< Vicinity factor of the neighbors of every cell, in the same order.
+			std::vector<std::shared_ptr<const CellConfig<C, S, V>>> owners;     //!< Cell configurations that own the vicinity factors.
+		};
+
 		nlohmann::json rawConfig;                                                           //!< JSON configuration file.
 		std::unordered_map<std::string, std::shared_ptr<CellConfig<C, S, V>>> cellConfigs;  //!< unordered map with all the different configurations.
+		nlohmann::json cellPatch;                                                           //!< Patch to the cell configurations of the prototype (replicas only).
+		std::shared_ptr<const Topology> topology;                                           //!< Topology of the model. It is computed when cells are indexed.
 	 public:
-		CellDEVSCoupled(const std::string& id, const std::string& configFilePath): Coupled(id), rawConfig(), cellConfigs() {
+		CellDEVSCoupled(const std::string& id, const std::string& configFilePath): Coupled(id), rawConfig(), cellConfigs(), cellPatch(), topology() {
 			std::ifstream i(configFilePath);
 			i >> rawConfig;
 		}
 
+		/**
+		 * Constructor function for replicating a Cell-DEVS model without parsing its configuration file again.
+		 * The new model shares the cell configurations already loaded by the prototype. Cells and couplings are not copied.
+		 * If the cells of the prototype are already built, the new model also shares its topology. Then, building the
+		 * new model does not compute the neighborhoods nor the indices of its cells again.
+		 * Replicas may patch the parameters of some cell configurations (e.g., {"default": {"config": {"seed": 7}}}).
+		 * Only the configurations affected by the patch are loaded again. Patches must not change the cells nor their neighborhoods.
+		 * @param id ID of the new Cell-DEVS model.
+		 * @param prototype Cell-DEVS model to be replicated.
+		 * @param patch patch to be applied to the cell configurations of the prototype (JSON object). By default, it is empty.
+		 * @throw CadmiumModelException if the patch refers to a cell configuration that the prototype does not define.
+		 */
+		CellDEVSCoupled(const std::string& id, const CellDEVSCoupled<C, S, V>& prototype, const nlohmann::json& patch = nlohmann::json::object()):
+			Coupled(id), rawConfig(prototype.rawConfig), cellConfigs(prototype.cellConfigs), cellPatch(patch), topology(prototype.topology) {
+			for (const auto& [configId, _patch]: cellPatch.items()) {
+				if (configId != "default" && !(rawConfig.contains("cells") && rawConfig["cells"].contains(configId))) {
+					throw CadmiumModelException("patch of unknown cell configuration " + configId);
+				}
+			}
+			if (!cellPatch.empty()) {
+				rawConfig["cells"].merge_patch(cellPatch);
+			}
+		}
+
 		/**
 	     * Generates a cell configuration struct from a JSON object.
 		 * @param configId ID of the configuration to be loaded.
@@ -60,13 +98,108 @@ namespace cadmium::celldevs {
 		 */
 		virtual void addDefaultCells(const std::shared_ptr<CellConfig<C, S, V>>& defaultConfig) {}
 
-		//! It builds the Cell-DEVS model completely
+		/**
+		 * It determines the simulation order of the cells (i.e., the order of their simulators and indices).
+		 * By default, cells are sorted by ID. Override it to place neighboring cells close to each other.
+		 * @param a first cell.
+		 * @param b second cell.
+		 * @return true if the first cell must be simulated before the second one.
+		 */
+		[[nodiscard]] virtual bool cellPrecedes(const Cell<C, S, V>& a, const Cell<C, S, V>& b) const {
+			return a.getId() < b.getId();
+		}
+
+		//! It builds the Cell-DEVS model completely. Cell configurations are only loaded if they were not loaded before.
 		void buildModel() {
-			loadCellConfigs();
-			addCells();
+			buildCells();
 			addCouplings();
 		}
 
+		/**
+		 * It only adds the cells of the Cell-DEVS model (i.e., it does not add any coupling).
+		 * Cell configurations are only loaded if they were not loaded before.
+		 * Use it instead of buildModel() for simulators that exchange neighbor states without couplings.
+		 */
+		void buildCells() {
+			if (cellConfigs.empty()) {
+				loadCellConfigs();
+			} else if (!cellPatch.empty()) {
+				patchCellConfigs();
+			}
+			addCells();
+			sortCells();
+			indexCells();
+		}
+
+		/**
+		 * It sorts the cells of the model according to cellPrecedes(). buildCells() already calls it.
+		 * @throw CadmiumModelException if a component of the model is not a cell.
+		 */
+		void sortCells() {
+			[[maybe_unused]] auto _cells = getCells();  // it checks that all the components are cells
+			this->sortComponents([this](const auto& a, const auto& b) {
+				return cellPrecedes(static_cast<const Cell<C, S, V>&>(*a), static_cast<const Cell<C, S, V>&>(*b));
+			});
+		}
+
+		/**
+		 * It indexes the cells (see getCells()), so cells route the states of their neighbors without hashing their IDs.
+		 * It also sets the flat neighborhood set of every cell from the topology of the model. Neighborhoods are only
+		 * computed (with CellConfig::buildNeighbors) when the topology is built. Replicas use the topology of their
+		 * prototype, so their cells point to the vicinity factors of the prototype. buildCells() already calls it.
+		 * @throw CadmiumModelException if a component of the model is not a cell or the cells do not match the topology.
+		 */
+		void indexCells() {
+			auto cells = getCells();
+			if (topology == nullptr) {
+				auto newTopology = std::make_shared<Topology>();
+				std::unordered_map<C, std::size_t> indices;
+				for (std::size_t i = 0; i < cells.size(); ++i) {
+					newTopology->cellIds.push_back(cells[i]->getCellId());
+					indices[cells[i]->getCellId()] = i;
+				}
+				for (const auto& cell: cells) {
+					const auto& cellConfig = cell->getCellConfig();
+					if (std::find(newTopology->owners.begin(), newTopology->owners.end(), cellConfig) == newTopology->owners.end()) {
+						newTopology->owners.push_back(cellConfig);
+					}
+					auto& neighborIndices = newTopology->neighborIndices.emplace_back();
+					auto& neighborVicinities = newTopology->neighborVicinities.emplace_back();
+					for (const auto& [neighbor, vicinity]: cellConfig->buildNeighbors(cell->getCellId())) {
+						neighborIndices.push_back(indices.at(neighbor));
+						neighborVicinities.push_back(vicinity);
+					}
+				}
+				topology = std::move(newTopology);
+			}
+			if (topology->cellIds.size() != cells.size()) {
+				throw CadmiumModelException("cells do not match the topology of the prototype");
+			}
+			for (std::size_t i = 0; i < cells.size(); ++i) {
+				if (!(cells[i]->getCellId() == topology->cellIds[i])) {
+					throw CadmiumModelException("cells do not match the topology of the prototype");
+				}
+				cells[i]->setNeighbors(i, topology->neighborIndices[i], topology->neighborVicinities[i]);
+			}
+		}
+
+		/**
+		 * It returns all the cells of the model in simulation order (see sortCells()). The position of a cell in the vector is its index.
+		 * @return vector with pointers to all the cells of the model.
+		 * @throw CadmiumModelException if a component of the model is not a cell.
+		 */
+		[[nodiscard]] std::vector<std::shared_ptr<Cell<C, S, V>>> getCells() const {
+			std::vector<std::shared_ptr<Cell<C, S, V>>> cells;
+			for (const auto& cell: Coupled::componentOrder) {
+				auto cellModel = std::dynamic_pointer_cast<Cell<C, S, V>>(cell);
+				if (cellModel == nullptr) {
+					throw CadmiumModelException("Scenario component is not a cell");
+				}
+				cells.push_back(cellModel);
+			}
+			return cells;
+		}
+
 		//! It reads the provided JSON file to load all the defined cell configuration structures.
 		void loadCellConfigs() {
 			auto configs = rawConfig.contains("cells") ? rawConfig["cells"] : nlohmann::json::object();
@@ -80,6 +213,26 @@ namespace cadmium::celldevs {
 			}
 		}
 
+		/**
+		 * It loads again the cell configurations affected by the patch of a replica. The rest are shared with the prototype.
+		 * Patching the default configuration affects all the configurations, as they are patches of the default one.
+		 */
+		void patchCellConfigs() {
+			const auto& configs = rawConfig.at("cells");
+			auto rawDefault = (configs.contains("default")) ? configs["default"] : nlohmann::json::object();
+			auto patchDefault = cellPatch.contains("default");
+			for (auto& [configId, cellConfig]: cellConfigs) {
+				if (configId == "default") {
+					if (patchDefault) {
+						cellConfig = this->loadCellConfig("default", rawDefault);
+					}
+				} else if (patchDefault || cellPatch.contains(configId)) {
+					cellConfig = loadCellConfig(configId, rawDefault, configs.at(configId));
+				}
+			}
+			cellPatch = nlohmann::json::object();
+		}
+
 		//! It adds all the cells according to the provided JSON configuration file.
 		void addCells() {
 			for (auto const&[configId, cellConfig]: cellConfigs) {
@@ -103,17 +256,23 @@ namespace cadmium::celldevs {
 			return this->loadCellConfig(configId, copyConfig);
 		}
 
-		//! It adds all the couplings required in the scenario according to the configuration file.
+		/**
+		 * It adds all the couplings required in the scenario according to the configuration file.
+		 * Internal couplings are taken from the topology of the model, so cells must be indexed first (see indexCells()).
+		 * @throw CadmiumModelException if the cells are not indexed.
+		 */
 		void addCouplings() {
-			for (const auto& [_, cell]: Coupled::components) {
-				auto cellModel = std::dynamic_pointer_cast<Cell<C, S, V>>(cell);
-				if (cellModel == nullptr) {
-					throw CadmiumModelException("Scenario component is not a cell");
-				}
-				for (const auto& neighbor: cellModel->getNeighborhood()) {
-					addIC(cellId(neighbor.first), "outputNeighborhood", cellModel->getId(), "inputNeighborhood");
+			auto cells = getCells();
+			for (std::size_t i = 0; i < cells.size(); ++i) {
+				if (topology == nullptr || cells[i]->getIndex() != i) {
+					throw CadmiumModelException("cells must be indexed before adding their couplings");
 				}
+				const auto& cellModel = cells[i];
 				auto cellConfig = cellModel->getCellConfig();
+				auto inPort = cellModel->getInPort("inputNeighborhood");
+				for (auto neighbor: topology->neighborIndices[i]) {
+					addIC(cells[neighbor]->getOutPort("outputNeighborhood"), inPort);
+				}
 				for (const auto& [portFrom, portTo]: cellConfig->EIC) {
 					addDynamicEIC(portFrom, cellModel->getId(), portTo);  // TODO
 				}
@@ -10,8 +10,12 @@
 #ifndef CADMIUM_CELLDEVS_CORE_MSG_HPP_
 #define CADMIUM_CELLDEVS_CORE_MSG_HPP_
 
+#include <cstddef>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <vector>
+#include "../../core/modeling/serialization.hpp"
 
 namespace cadmium::celldevs {
 	/**
@@ -21,15 +25,21 @@ namespace cadmium::celldevs {
 	 */
 	template <typename C, typename S>
 	struct CellStateMessage {
+		//! Sender index of messages whose sending cell does not have an index.
+		static constexpr std::size_t noIndex = std::numeric_limits<std::size_t>::max();
+
 		C cellId;	                     //! ID of the cell that generated the message.
 		std::shared_ptr<const S> state;	 //! pointer to a copy of the cell state when the message was created.
+		std::size_t senderIndex;         //! index of the cell that generated the message within its Cell-DEVS model.
 
 		/**
 		 * Constructor function
 		 * @param cellId ID of the cell that sends the message.
 		 * @param state State shared by the sending cell.
+		 * @param senderIndex index of the cell that sends the message. Receivers use it to find the neighbor without hashing its ID.
 		 */
-		CellStateMessage(C cellId, std::shared_ptr<const S> state): cellId(cellId), state(state) {}
+		CellStateMessage(C cellId, std::shared_ptr<const S> state, std::size_t senderIndex = noIndex):
+		  cellId(cellId), state(state), senderIndex(senderIndex) {}
 	};
 
 	/**
@@ -47,4 +57,27 @@ namespace cadmium::celldevs {
 	}
 } // namespace cadmium::celldevs
 
+namespace cadmium {
+	/**
+	 * Serializer of cell state messages. It serializes the cell ID, a copy of the cell state, and the sender index.
+	 * Both C and S must be serializable.
+	 * @tparam C the type used for representing a cell ID.
+	 * @tparam S the type used for representing a cell state.
+	 */
+	template <typename C, typename S>
+	struct Serializer<celldevs::CellStateMessage<C, S>> {
+		static void write(std::vector<char>& buffer, const celldevs::CellStateMessage<C, S>& msg) {
+			Serializer<C>::write(buffer, msg.cellId);
+			Serializer<std::shared_ptr<const S>>::write(buffer, msg.state);
+			Serializer<std::size_t>::write(buffer, msg.senderIndex);
+		}
+
+		static celldevs::CellStateMessage<C, S> read(const char*& cursor, const char* end) {
+			auto cellId = Serializer<C>::read(cursor, end);
+			auto state = Serializer<std::shared_ptr<const S>>::read(cursor, end);
+			return {cellId, state, Serializer<std::size_t>::read(cursor, end)};
+		}
+	};
+} // namespace cadmium
+
 #endif // CADMIUM_CELLDEVS_CORE_MSG_HPP_
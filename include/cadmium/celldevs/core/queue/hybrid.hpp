@@ -14,30 +14,32 @@
 #include <deque>
 #include <utility>
 #include "queue.hpp"
+#include "../../../core/modeling/time.hpp"
 
 namespace cadmium::celldevs {
-	template <typename S>
+	template <typename S, typename T>
 	struct OutputQueue;
 
 	/**
 	 * @brief Cell-DEVS output queue and delay functions.
 	 * @tparam S the type used for representing a cell state.
+	 * @tparam T the type used for representing the simulation time.
 	 */
-	template <typename S>
-	class HybridOutputQueue: public OutputQueue<S> {
+	template <typename S, typename T = double>
+	class HybridOutputQueue: public OutputQueue<S, T> {
 	 private:
 		std::shared_ptr<const S> nullPtr = nullptr;  //!< Just a reference for detecting empty queues.
-		std::deque<std::pair<double, std::shared_ptr<const S>>> states;  //!< Double-ended queue with pairs <time, state>
+		std::deque<std::pair<T, std::shared_ptr<const S>>> states;  //!< Double-ended queue with pairs <time, state>
 	 public:
 		//! Constructor function.
-		HybridOutputQueue(): OutputQueue<S>(), states() {}
+		HybridOutputQueue(): OutputQueue<S, T>(), states() {}
 
 		/**
 		 * Adds a new state to the output queue, and schedules its propagation at a given time.
 		 * @param state state to be transmitted by the cell.
 		 * @param when clock time when this state must be transmitted.
 		 */
-		[[maybe_unused]] void addToQueue(S state, double when) override {
+		[[maybe_unused]] void addToQueue(S state, T when) override {
 			while (!states.empty() && states.back().first >= when) {
 				states.pop_back();
 			}
@@ -45,8 +47,8 @@ namespace cadmium::celldevs {
 		}
 
 		//! @return clock time for the next scheduled output.
-		[[maybe_unused]] [[nodiscard]] double nextTime() const override {
-			return (states.empty())? std::numeric_limits<double>::infinity() : states.front().first;
+		[[maybe_unused]] [[nodiscard]] T nextTime() const override {
+			return (states.empty())? TimeTraits<T>::infinity() : states.front().first;
 		}
 
 		//! @return next cell state to be transmitted.
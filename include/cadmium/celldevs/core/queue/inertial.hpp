@@ -14,36 +14,38 @@
 #include <memory>
 #include <utility>
 #include "queue.hpp"
+#include "../../../core/modeling/time.hpp"
 
 namespace cadmium::celldevs {
-	template <typename S>
+	template <typename S, typename T>
 	struct OutputQueue;
 
 	/**
 	 * @brief Cell-DEVS output queue and delay functions.
 	 * @tparam S the type used for representing a cell state.
+	 * @tparam T the type used for representing the simulation time.
 	 */
-	template <typename S>
-	class InertialOutputQueue: public OutputQueue<S> {
+	template <typename S, typename T = double>
+	class InertialOutputQueue: public OutputQueue<S, T> {
 	 private:
 		std::shared_ptr<const S> lastState;  //!< Pointer to last copy of cell state.
-		double next;                         //!< Simulation time at which the cell must output its state.
+		T next;                              //!< Simulation time at which the cell must output its state.
 	 public:
 		//! Constructor function. Last state is nullptr and next time is infinity
-		InertialOutputQueue(): OutputQueue<S>(), lastState(), next(std::numeric_limits<double>::infinity()) {}
+		InertialOutputQueue(): OutputQueue<S, T>(), lastState(), next(TimeTraits<T>::infinity()) {}
 
 		/**
 		 * Adds a new state to the output queue, and schedules its propagation at a given time.
 		 * @param state copy of the new cell state.
 		 * @param when clock time when this state must be transmitted.
 		 */
-		[[maybe_unused]] void addToQueue(S state, double when) override {
+		[[maybe_unused]] void addToQueue(S state, T when) override {
 			lastState = std::make_shared<const S>(std::move(state));
 			next = when;
 		}
 
 		//! @return clock time for the next scheduled output.
-		[[maybe_unused]] [[nodiscard]] double nextTime() const override {
+		[[maybe_unused]] [[nodiscard]] T nextTime() const override {
 			return next;
 		}
 
@@ -55,7 +57,7 @@ namespace cadmium::celldevs {
 		//! Removes from buffer the next scheduled state transmission.
 		void pop() override {
 			lastState = nullptr;
-			next = std::numeric_limits<double>::infinity();
+			next = TimeTraits<T>::infinity();
 		}
 	};
 } // namespace cadmium::celldevs
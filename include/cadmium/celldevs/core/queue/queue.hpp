@@ -17,6 +17,7 @@
 #include "transport.hpp"
 #include "hybrid.hpp"
 #include "../../../core/exception.hpp"
+#include "../../../core/modeling/time.hpp"
 
 namespace cadmium::celldevs {
 	/**
@@ -24,8 +25,9 @@ namespace cadmium::celldevs {
 	 *
 	 * Interface for implementing Cell-DEVS output queues ruled by a delay type function.
 	 * @tparam S the type used for representing a cell state.
+	 * @tparam T the type used for representing the simulation time.
 	 */
-	template <typename S>
+	template <typename S, typename T = double>
 	struct OutputQueue {
 		//! Virtual destructor function.
 		virtual ~OutputQueue() = default;
@@ -35,10 +37,10 @@ namespace cadmium::celldevs {
 		 * @param state state to be transmitted by the cell.
 		 * @param when clock time when this state must be transmitted.
 		 */
-		virtual void addToQueue(S state, double when) = 0;
+		virtual void addToQueue(S state, T when) = 0;
 
 		//! @return clock time for the next scheduled output.
-		[[nodiscard]] virtual double nextTime() const = 0;
+		[[nodiscard]] virtual T nextTime() const = 0;
 
 		//! @return next cell state to be transmitted.
 		virtual const std::shared_ptr<const S>& nextState() const = 0;
@@ -52,13 +54,13 @@ namespace cadmium::celldevs {
 		 * @return unique pointer pointing to a new output queue structure. If delay type is not found, it raises
 		 * @throw Exception if delay type function ID is unknown (i.e., it is not "inertial", "transport", nor "hybrid").
 		 */
-		static std::unique_ptr<OutputQueue<S>> newOutputQueue(std::string const &delayType) {
+		static std::unique_ptr<OutputQueue<S, T>> newOutputQueue(std::string const &delayType) {
 			if (delayType == "inertial") {
-				return std::make_unique<InertialOutputQueue<S>>();
+				return std::make_unique<InertialOutputQueue<S, T>>();
 			} else if (delayType == "transport") {
-				return std::make_unique<TransportOutputQueue<S>>();
+				return std::make_unique<TransportOutputQueue<S, T>>();
 			} else if (delayType == "hybrid") {
-				return std::make_unique<HybridOutputQueue<S>>();
+				return std::make_unique<HybridOutputQueue<S, T>>();
 			} else {
 				throw CadmiumModelException("delay type function not implemented");
 			}
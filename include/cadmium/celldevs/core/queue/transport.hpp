@@ -17,32 +17,34 @@
 #include <utility>
 #include <vector>
 #include "queue.hpp"
+#include "../../../core/modeling/time.hpp"
 
 namespace cadmium::celldevs {
-	template <typename S>
+	template <typename S, typename T>
 	struct OutputQueue;
 
 	/**
 	 * @brief Cell-DEVS output queue and delay functions.
 	 * @tparam S the type used for representing a cell state.
+	 * @tparam T the type used for representing the simulation time.
 	 */
-	template <typename S>
-	class TransportOutputQueue: public OutputQueue<S> {
+	template <typename S, typename T = double>
+	class TransportOutputQueue: public OutputQueue<S, T> {
 	 private:
 		std::shared_ptr<const S> nullPtr = nullptr;  //!< Just a reference for detecting empty queues.
-		std::priority_queue<double, std::vector<double>, std::greater<>> timeline;  //!< Queue with times with scheduled events.
-		std::unordered_map<double, std::shared_ptr<const S>> states;  //!< Unordered map {scheduled time: state to transmit}.
+		std::priority_queue<T, std::vector<T>, std::greater<>> timeline;  //!< Queue with times with scheduled events.
+		std::unordered_map<T, std::shared_ptr<const S>> states;  //!< Unordered map {scheduled time: state to transmit}.
 	 public:
 
 		//! Constructor function.
-		TransportOutputQueue(): OutputQueue<S>(), timeline(), states() {}
+		TransportOutputQueue(): OutputQueue<S, T>(), timeline(), states() {}
 
 		/**
 		 * Adds a new state to the output queue, and schedules its propagation at a given time.
 		 * @param state state to be transmitted by the cell.
 		 * @param when clock time when this state must be transmitted.
 		 */
-		[[maybe_unused]] void addToQueue(S state, double when) override {
+		[[maybe_unused]] void addToQueue(S state, T when) override {
 			if (states.find(when) == states.end()) {
 				timeline.push(when);
 			}
@@ -50,8 +52,8 @@ namespace cadmium::celldevs {
 		}
 
 		//! @return clock time for the next scheduled output.
-		[[maybe_unused]] [[nodiscard]] double nextTime() const override {
-			return (timeline.empty())? std::numeric_limits<double>::infinity() : timeline.top();
+		[[maybe_unused]] [[nodiscard]] T nextTime() const override {
+			return (timeline.empty())? TimeTraits<T>::infinity() : timeline.top();
 		}
 
 		//! @return next cell state to be transmitted.
@@ -10,6 +10,7 @@
 #ifndef CADMIUM_CELLDEVS_CORE_UTILITY_HPP_
 #define CADMIUM_CELLDEVS_CORE_UTILITY_HPP_
 
+#include <cstddef>
 #include <nlohmann/json.hpp>
 #include <memory>
 #include <utility>
@@ -36,6 +37,89 @@ namespace cadmium::celldevs {
 		explicit NeighborData(V vicinity) : state(), vicinity(std::move(vicinity)) {}
 	};
 
+	/**
+	 * @brief Entry of a flat neighborhood set.
+	 * @tparam S type used to represent cell states.
+	 * @tparam V type used to represent vicinities between cells.
+	 */
+	template<typename S, typename V>
+	struct NeighborEntry {
+		const S* state;     //!< Pointer to the latest known state of the neighboring cell. It is null until the neighbor outputs its state.
+		const V& vicinity;  //!< Vicinity factor of neighboring cell over the cell that holds the entry.
+	};
+
+	/**
+	 * @brief Read-only view of a flat neighborhood set.
+	 *
+	 * States are stored by the cell that holds the neighborhood. Vicinity factors are shared by all the cells
+	 * with the same configuration, so the view only stores pointers to them.
+	 * @tparam S type used to represent cell states.
+	 * @tparam V type used to represent vicinities between cells.
+	 */
+	template<typename S, typename V>
+	class NeighborSpan {
+	 private:
+		const std::shared_ptr<const S>* states;  //!< Pointer to the state of the first neighbor.
+		const V* const* vicinities;              //!< Pointer to the vicinity of the first neighbor.
+		std::size_t nEntries;                    //!< Number of neighbors.
+	 public:
+		//! Iterator over the entries of the flat neighborhood set.
+		class Iterator {
+			const std::shared_ptr<const S>* state;  //!< Pointer to the state of the current neighbor.
+			const V* const* vicinity;               //!< Pointer to the vicinity of the current neighbor.
+		 public:
+			Iterator(const std::shared_ptr<const S>* state, const V* const* vicinity) : state(state), vicinity(vicinity) {}
+
+			bool operator!=(const Iterator& b) const {
+				return state != b.state;
+			}
+
+			Iterator& operator++() {
+				++state;
+				++vicinity;
+				return *this;
+			}
+
+			NeighborEntry<S, V> operator*() const {
+				return {state->get(), **vicinity};
+			}
+		};
+
+		/**
+		 * Constructor function.
+		 * @param states pointer to the state of the first neighbor.
+		 * @param vicinities pointer to the vicinity of the first neighbor.
+		 * @param nEntries number of neighbors.
+		 */
+		NeighborSpan(const std::shared_ptr<const S>* states, const V* const* vicinities, std::size_t nEntries) :
+		  states(states), vicinities(vicinities), nEntries(nEntries) {}
+
+		//! @return number of neighbors.
+		[[nodiscard]] std::size_t size() const {
+			return nEntries;
+		}
+
+		//! @return true if there are no neighbors.
+		[[nodiscard]] bool empty() const {
+			return nEntries == 0;
+		}
+
+		//! @return the i-th entry.
+		NeighborEntry<S, V> operator[](std::size_t i) const {
+			return {states[i].get(), *vicinities[i]};
+		}
+
+		//! @return iterator to the first entry.
+		[[nodiscard]] Iterator begin() const {
+			return {states, vicinities};
+		}
+
+		//! @return iterator past the last entry.
+		[[nodiscard]] Iterator end() const {
+			return {states + nEntries, vicinities + nEntries};
+		}
+	};
+
 	/**
 	 * Function to deserialize a JSON object as a neighbor data object in the JSON notation.
 	 * Note that the neighboring cell state is always a null pointer, as this is a simulation-only parameter.
@@ -10,6 +10,7 @@
 #ifndef CADMIUM_CELLDEVS_GRID_CELL_HPP_
 #define CADMIUM_CELLDEVS_GRID_CELL_HPP_
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 #include "../core/cell.hpp"
@@ -22,18 +23,23 @@ namespace cadmium::celldevs {
 	 * @brief Abstract base class for cells in grid Cell-DEVS scenarios.
 	 * @tparam S type used to represent cell states.
 	 * @tparam V type used to represent vicinities between cells.
+	 * @tparam N number of dimensions of the scenario. By default, it is 0 (i.e., it is only known at runtime).
 	 */
-	template <typename S, typename V>
-	class GridCell: public Cell<coordinates, S, V> {
-		using Cell<coordinates, S, V>::id;                   //!< Cell ID (i.e., cell position in the grid).
-		const std::shared_ptr<const GridScenario> scenario;  //!< pointer to current Cell-DEVS scenario.
+	template <typename S, typename V, std::size_t N = 0>
+	class GridCell: public Cell<gridCoordinates<N>, S, V> {
+	 public:
+		using coordinates = gridCoordinates<N>;                    //!< Type used for representing cell coordinates.
+	 protected:
+		using Cell<coordinates, S, V>::id;                         //!< Cell ID (i.e., cell position in the grid).
+	 private:
+		const std::shared_ptr<const BasicGridScenario<N>> scenario;  //!< pointer to current Cell-DEVS scenario.
 	 public:
 		/**
 		 * Creates a new cell for a grid Cell-DEVS model.
 		 * @param id ID of the cell to be created (i.e., cell position in the grid).
 		 * @param config configuration parameters for creating the grid cell.
 		 */
-		GridCell(const coordinates& id, const std::shared_ptr<const GridCellConfig<S, V>>& config):
+		GridCell(const coordinates& id, const std::shared_ptr<const GridCellConfig<S, V, N>>& config):
 			Cell<coordinates, S, V>(id, config), scenario(config->scenario) {}
 		/**
 		 * It computes the distance vector from the current cell to the destination cell provided.
@@ -10,6 +10,7 @@
 #ifndef CADMIUM_CELLDEVS_GRID_CONFIG_HPP_
 #define CADMIUM_CELLDEVS_GRID_CONFIG_HPP_
 
+#include <algorithm>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <unordered_map>
@@ -21,18 +22,58 @@
 #include "../../core/exception.hpp"
 
 namespace cadmium::celldevs {
+	/**
+	 * It reads cell coordinates (or distance vectors) from a JSON array.
+	 * @tparam N number of dimensions of the scenario (0 if it is only known at runtime).
+	 * @param rawCoordinates JSON array with the coordinates.
+	 * @return the resulting coordinates.
+	 * @throw CadmiumModelException if N is greater than 0 and the JSON array does not have N elements.
+	 */
+	template <std::size_t N>
+	gridCoordinates<N> parseCoordinates(const nlohmann::json& rawCoordinates) {
+		auto res = rawCoordinates.get<coordinates>();
+		if constexpr (N == 0) {
+			return res;
+		} else {
+			if (res.size() != N) {
+				throw CadmiumModelException("invalid number of dimensions");
+			}
+			gridCoordinates<N> fixed{};
+			std::copy(res.begin(), res.end(), fixed.begin());
+			return fixed;
+		}
+	}
+
+	/**
+	 * It reads a list of cell coordinates (or distance vectors) from a JSON array.
+	 * @tparam N number of dimensions of the scenario (0 if it is only known at runtime).
+	 * @param rawCoordinates JSON array with the coordinates.
+	 * @return vector with the resulting coordinates.
+	 */
+	template <std::size_t N>
+	std::vector<gridCoordinates<N>> parseCoordinatesList(const nlohmann::json& rawCoordinates) {
+		std::vector<gridCoordinates<N>> res;
+		for (const auto& raw: rawCoordinates) {
+			res.push_back(parseCoordinates<N>(raw));
+		}
+		return res;
+	}
+
 	/**
 	 * @brief Grid cell configuration structure.
 	 * @tparam S type used to represent cell states.
 	 * @tparam V type used to represent vicinities between cells.
+	 * @tparam N number of dimensions of the scenario. By default, it is 0 (i.e., it is only known at runtime).
 	 */
-	template<typename S, typename V>
-	struct GridCellConfig : public CellConfig<coordinates, S, V> {
+	template<typename S, typename V, std::size_t N = 0>
+	struct GridCellConfig : public CellConfig<gridCoordinates<N>, S, V> {
+		using coordinates = gridCoordinates<N>;  //!< Type used for representing cell coordinates.
 		using CellConfig<coordinates, S, V>::rawNeighborhood;
 		std::vector<coordinates> cellMap;  //!< Vector of cells with this configuration. By default, it is empty.
-		const std::shared_ptr<const GridScenario> scenario;  //!< Pointer to the grid Cell-DEVS scenario.
+		const std::shared_ptr<const BasicGridScenario<N>> scenario;  //!< Pointer to the grid Cell-DEVS scenario.
 		std::unordered_map<coordinates, NeighborData<S, V>> absolute;  //!< Pre-processed neighborhood (only absolute neighbors).
 		std::unordered_map<coordinates, NeighborData<S, V>> relative;  //!< Pre-processed neighborhood (only relative neighbors).
+		std::vector<std::pair<coordinates, const V*>> stencil;         //!< Relative neighbors sorted by distance vector. Vicinities are owned by relative.
 
 		/**
 		 * Creates a new cell configuration structure from a JSON object.
@@ -40,10 +81,10 @@ namespace cadmium::celldevs {
 		 * @param configParams JSON object containing all the cell configuration parameters.
 		 * @param scenario  pointer to the grid Cell-DEVS scenario.
 		 */
-		GridCellConfig(std::string configId, const nlohmann::json& configParams, std::shared_ptr<const GridScenario>  scenario):
-			CellConfig<coordinates, S, V>(configId, configParams), cellMap(), scenario(std::move(scenario)), absolute(), relative() {
+		GridCellConfig(std::string configId, const nlohmann::json& configParams, std::shared_ptr<const BasicGridScenario<N>>  scenario):
+			CellConfig<coordinates, S, V>(configId, configParams), cellMap(), scenario(std::move(scenario)), absolute(), relative(), stencil() {
 			if (!CellConfig<coordinates, S, V>::isDefault() && configParams.contains("cell_map")) {
-				cellMap = configParams["cell_map"].get<std::vector<coordinates>>();
+				cellMap = parseCoordinatesList<N>(configParams["cell_map"]);
 			}
 			processNeighborhood();
 		}
@@ -52,13 +93,14 @@ namespace cadmium::celldevs {
 		 * It reads the JSON file and pre-process the corresponding neighborhood.
 		 * The resulting neighborhood is divided into "absolute" (i.e., the same neighborhood for all the cells),
 		 * and "relative" (i.e., defined by distance vectors, each cell will have a different resulting neighborhood).
+		 * Then, it sorts the relative neighbors by distance vector, so all the cells visit their neighbors in the same order.
 		 */
 		void processNeighborhood() {
 			for (const nlohmann::json& rawNeighbors: rawNeighborhood) {
 				auto type = rawNeighbors.at("type").get<std::string>();
 				auto vicinity = (rawNeighbors.contains("vicinity")) ? rawNeighbors["vicinity"].get<V>() : V();
 				if (type == "absolute") {
-					auto neighbors = rawNeighbors.at("neighbors").get<std::vector<coordinates>>();
+					auto neighbors = parseCoordinatesList<N>(rawNeighbors.at("neighbors"));
 					for (const auto& neighbor: neighbors) {
 						if (scenario->cellInScenario(neighbor)) {
 							absolute[neighbor] = NeighborData<S, V>(vicinity);
@@ -69,7 +111,7 @@ namespace cadmium::celldevs {
 				} else {
 					std::vector<coordinates> distances;
 					if (type == "relative") {
-						distances = rawNeighbors.at("neighbors").get<std::vector<coordinates>>();
+						distances = parseCoordinatesList<N>(rawNeighbors.at("neighbors"));
 					}
 					else if (type == "moore") {
 						auto range = (rawNeighbors.contains("range")) ? rawNeighbors["range"].get<int>() : 1;
@@ -104,6 +146,13 @@ namespace cadmium::celldevs {
 					}
 				}
 			}
+			stencil.clear();
+			for (const auto& [distance, data]: relative) {
+				stencil.emplace_back(distance, &data.vicinity);
+			}
+			std::sort(stencil.begin(), stencil.end(), [](const auto& a, const auto& b) {
+				return a.first < b.first;
+			});
 		}
 
 		/**
@@ -125,6 +174,43 @@ namespace cadmium::celldevs {
 			}
 			return neighborhood;
 		}
+
+		/**
+		 * It builds the flat neighborhood set for a given cell.
+		 * All the cells with this configuration share the vicinity factors of the pre-processed neighborhood.
+		 * Relative neighbors follow the stencil order, and absolute neighbors go after them.
+		 * Neighbors that appear twice (e.g., in small wrapped scenarios) are only considered once.
+		 * Absolute neighbors override the vicinity of relative neighbors.
+		 * @param cellId ID of the target cell that will own the resulting neighborhood set.
+		 * @return vector of pairs {neighboring cell ID, pointer to the vicinity factor of neighboring cell over target cell}.
+		 */
+		std::vector<std::pair<coordinates, const V*>> buildNeighbors(const coordinates& cellId) const override {
+			std::vector<std::pair<coordinates, const V*>> neighbors;
+			neighbors.reserve(stencil.size() + absolute.size());
+			auto find = [&neighbors](const coordinates& neighbor) {
+				return std::find_if(neighbors.begin(), neighbors.end(), [&neighbor](const auto& n) { return n.first == neighbor; });
+			};
+			for (const auto& [distance, vicinity]: stencil) {
+				try {
+					auto neighbor = scenario->cellTo(cellId, distance);
+					// Different distance vectors only lead to the same neighbor in wrapped scenarios
+					if (!scenario->wrapped || find(neighbor) == neighbors.end()) {
+						neighbors.emplace_back(std::move(neighbor), vicinity);
+					}
+				} catch (CadmiumModelException&) {
+					continue;
+				}
+			}
+			for (const auto& [neighbor, data]: absolute) {
+				auto it = find(neighbor);
+				if (it == neighbors.end()) {
+					neighbors.emplace_back(neighbor, &data.vicinity);
+				} else {
+					it->second = &data.vicinity;
+				}
+			}
+			return neighbors;
+		}
 	};
 }
 
@@ -11,6 +11,7 @@
 #define CADMIUM_CELLDEVS_GRID_COUPLED_HPP_
 
 #include <nlohmann/json.hpp>
+#include <cstddef>
 #include <memory>
 #include <vector>
 #include "cell.hpp"
@@ -21,20 +22,24 @@
 
 namespace cadmium::celldevs {
 
-	template <typename S, typename V>
-	using gridCellFactory = std::shared_ptr<GridCell<S, V>>(*)(const coordinates & cellId, const std::shared_ptr<const GridCellConfig<S, V>>& cellConfig);
+	template <typename S, typename V, std::size_t N = 0>
+	using gridCellFactory = std::shared_ptr<GridCell<S, V, N>>(*)(const gridCoordinates<N> & cellId, const std::shared_ptr<const GridCellConfig<S, V, N>>& cellConfig);
 
 	/**
 	 * @brief Coupled grid Cell-DEVS model.
 	 * @tparam S the type used for representing a cell state.
 	 * @tparam V the type used for representing a neighboring cell's vicinities.
+	 * @tparam N number of dimensions of the scenario. By default, it is 0 (i.e., it is only known at runtime).
+	 * If it is greater than 0, cell coordinates are arrays and the scenario configuration file must have N dimensions.
 	 */
-	template <typename S, typename V>
-	class GridCellDEVSCoupled: public CellDEVSCoupled<coordinates, S, V> {
+	template <typename S, typename V, std::size_t N = 0>
+	class GridCellDEVSCoupled: public CellDEVSCoupled<gridCoordinates<N>, S, V> {
+	 public:
+		using coordinates = gridCoordinates<N>;         //!< Type used for representing cell coordinates.
 	 private:
 		using CellDEVSCoupled<coordinates, S, V>::rawConfig;
-		std::shared_ptr<GridScenario> scenario;  //!< Pointer to the scenario configuration.
-		gridCellFactory<S, V> factory;           //!< Pointer to grid cell factory function.
+		std::shared_ptr<BasicGridScenario<N>> scenario;  //!< Pointer to the scenario configuration.
+		gridCellFactory<S, V, N> factory;                //!< Pointer to grid cell factory function.
 	 public:
 		/**
 		 * Constructor function.
@@ -42,15 +47,27 @@ namespace cadmium::celldevs {
 		 * @param factory pointer to grid cell factory function.
 		 * @param configFilePath path to the scenario configuration file.
 		 */
-		GridCellDEVSCoupled(const std::string& id, gridCellFactory<S, V> factory, const std::string& configFilePath):
+		GridCellDEVSCoupled(const std::string& id, gridCellFactory<S, V, N> factory, const std::string& configFilePath):
 		  CellDEVSCoupled<coordinates, S, V>(id, configFilePath), factory(factory) {
 			nlohmann::json rawScenario = rawConfig.at("scenario");
-			auto shape = rawScenario.at("shape").get<coordinates>();
-			auto origin = rawScenario.contains("origin")? rawScenario["origin"].get<coordinates>() : coordinates(shape.size(), 0);
+			auto shape = parseCoordinates<N>(rawScenario.at("shape"));
+			auto origin = rawScenario.contains("origin")? parseCoordinates<N>(rawScenario["origin"]) : filledCoordinates<N>(shape.size(), 0);
 			auto wrapped = rawScenario.contains("wrapped") && rawScenario["wrapped"].get<bool>();
-			scenario = std::make_shared<GridScenario>(shape, origin, wrapped);
+			scenario = std::make_shared<BasicGridScenario<N>>(shape, origin, wrapped);
 		}
 
+		/**
+		 * Constructor function for replicating a grid Cell-DEVS model.
+		 * The new model shares the scenario, the cell factory, and the cell configurations of the prototype.
+		 * Call buildCells() on the prototype first, so replicas do not load the cell configurations nor compute
+		 * the topology again (see CellDEVSCoupled). Replicas may patch the parameters of the cell configurations.
+		 * @param id ID of the new coupled grid Cell-DEVS model.
+		 * @param prototype grid Cell-DEVS model to be replicated.
+		 * @param patch patch to be applied to the cell configurations of the prototype (JSON object). By default, it is empty.
+		 */
+		GridCellDEVSCoupled(const std::string& id, const GridCellDEVSCoupled<S, V, N>& prototype, const nlohmann::json& patch = nlohmann::json::object()):
+		  CellDEVSCoupled<coordinates, S, V>(id, prototype, patch), scenario(prototype.scenario), factory(prototype.factory) {}
+
 		/**
 	     * Generates a cell configuration struct from a JSON object.
 		 * @param configId ID of the configuration to be loaded.
@@ -58,7 +75,7 @@ namespace cadmium::celldevs {
 		 * @return pointer to the cell configuration created.
 		 */
 		std::shared_ptr<CellConfig<coordinates, S, V>> loadCellConfig(const std::string& configId, const nlohmann::json& cellConfig) const override {
-			return std::make_shared<GridCellConfig<S, V>>(configId, cellConfig, scenario);
+			return std::make_shared<GridCellConfig<S, V, N>>(configId, cellConfig, scenario);
 		}
 
 		/**
@@ -66,7 +83,7 @@ namespace cadmium::celldevs {
 		 * @param cellConfig target cell configuration struct.
 		 */
 		void addCells(const std::shared_ptr<CellConfig<coordinates, S, V>>& cellConfig) override {
-			auto config = std::dynamic_pointer_cast<GridCellConfig<S, V>>(cellConfig);
+			auto config = std::dynamic_pointer_cast<GridCellConfig<S, V, N>>(cellConfig);
 			if (config == nullptr) {
 				throw CadmiumModelException("invalid cell configuration data type");
 			}
@@ -75,12 +92,23 @@ namespace cadmium::celldevs {
 			}
 		}
 
+		/**
+		 * Grid cells are simulated following the Z-order curve of the scenario (see BasicGridScenario::mortonPrecedes).
+		 * Thus, neighboring cells have close indices, and their simulators and neighbor states are close in memory.
+		 * @param a first cell.
+		 * @param b second cell.
+		 * @return true if the first cell must be simulated before the second one.
+		 */
+		[[nodiscard]] bool cellPrecedes(const Cell<coordinates, S, V>& a, const Cell<coordinates, S, V>& b) const override {
+			return scenario->mortonPrecedes(a.getCellId(), b.getCellId());
+		}
+
 		/**
 		 * After adding all the cells with special configuration, it adds the remaining default cells.
 		 * @param defaultConfig default cell configuration struct.
 		 */
 		void addDefaultCells(const std::shared_ptr<CellConfig<coordinates, S, V>>& defaultConfig) override {
-			auto config = std::dynamic_pointer_cast<GridCellConfig<S, V>>(defaultConfig);
+			auto config = std::dynamic_pointer_cast<GridCellConfig<S, V, N>>(defaultConfig);
 			if (config == nullptr) {
 				throw CadmiumModelException("invalid cell configuration data type");
 			}
@@ -0,0 +1,673 @@
+/**
+ * Dense simulation engine for grid Cell-DEVS scenarios.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CELLDEVS_GRID_DENSE_HPP_
+#define CADMIUM_CELLDEVS_GRID_DENSE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "config.hpp"
+#include "scenario.hpp"
+#include "stencil.hpp"
+#include "utility.hpp"
+#include "../../core/exception.hpp"
+#include "../../core/logger/logger.hpp"
+#include "../../core/modeling/time.hpp"
+#include "../../core/simulation/calendar_queue.hpp"
+
+namespace cadmium::celldevs {
+	/**
+	 * @brief Read-only view of the neighborhood of a cell in a dense grid Cell-DEVS scenario.
+	 *
+	 * It contains the latest state output by every neighboring cell and its vicinity factor.
+	 * Neighbors can be visited with range-based for loops (e.g., for (const auto& [state, vicinity]: neighborhood)).
+	 * @tparam S the type used for representing a cell state.
+	 * @tparam V the type used for representing a neighboring cell's vicinities.
+	 */
+	template <typename S, typename V>
+	class DenseNeighborhood {
+	 public:
+		//! Neighboring cell data.
+		struct Neighbor {
+			const S& state;     //!< Latest state output by the neighboring cell.
+			const V& vicinity;  //!< Vicinity factor of the neighboring cell over the cell that holds the neighborhood.
+		};
+
+		//! Iterator over the neighboring cells.
+		class Iterator {
+			const DenseNeighborhood *neighborhood;  //!< Pointer to the neighborhood being iterated.
+			std::size_t i;                          //!< Position of the current neighbor.
+		 public:
+			Iterator(const DenseNeighborhood *neighborhood, std::size_t i): neighborhood(neighborhood), i(i) {}
+
+			bool operator!=(const Iterator& b) const {
+				return i != b.i;
+			}
+
+			Iterator& operator++() {
+				++i;
+				return *this;
+			}
+
+			Neighbor operator*() const {
+				return (*neighborhood)[i];
+			}
+		};
+
+	 private:
+		const std::vector<S>& states;                                   //!< Latest state output by every cell.
+		const std::vector<std::pair<std::size_t, const V*>>& neighbors;  //!< Pairs <neighbor index, vicinity>.
+	 public:
+		/**
+		 * Constructor function.
+		 * @param states latest state output by every cell of the scenario.
+		 * @param neighbors pairs <linear index of the neighboring cell, pointer to its vicinity factor>.
+		 */
+		DenseNeighborhood(const std::vector<S>& states, const std::vector<std::pair<std::size_t, const V*>>& neighbors):
+		  states(states), neighbors(neighbors) {}
+
+		//! @return number of neighboring cells.
+		[[nodiscard]] std::size_t size() const {
+			return neighbors.size();
+		}
+
+		/**
+		 * @param i position of a neighboring cell.
+		 * @return data of the neighboring cell.
+		 */
+		Neighbor operator[](std::size_t i) const {
+			return {states[neighbors[i].first], *neighbors[i].second};
+		}
+
+		Iterator begin() const {
+			return {this, 0};
+		}
+
+		Iterator end() const {
+			return {this, neighbors.size()};
+		}
+	};
+
+	/**
+	 * @brief Abstract base class for the local rules of dense grid Cell-DEVS scenarios.
+	 *
+	 * Dense scenarios do not create one atomic model per cell. Instead, all the cells with the same configuration
+	 * share a rule, which computes their next state. Rules can read the configuration parameters of their cells
+	 * (e.g., the "config" field of the configuration) when they are created.
+	 * @tparam S the type used for representing a cell state.
+	 * @tparam V the type used for representing a neighboring cell's vicinities.
+	 * @tparam T the type used for representing the simulation time. By default, it is double.
+	 */
+	template <typename S, typename V, typename T = double>
+	class DenseGridRule {
+	 public:
+		virtual ~DenseGridRule() = default;
+
+		/**
+		 * Local computation function. It computes the new state of a cell.
+		 * @param state copy of the current state of the cell.
+		 * @param neighborhood neighborhood of the cell.
+		 * @return new state of the cell.
+		 */
+		virtual S localComputation(S state, const DenseNeighborhood<S, V>& neighborhood) const = 0;
+
+		/**
+		 * Output delay function. It determines the time to wait before outputting a message with the new cell state.
+		 * @param state new cell state.
+		 * @return simulation time to wait before outputting a message with the new cell state.
+		 */
+		virtual T outputDelay(const S& state) const = 0;
+
+		/**
+		 * It checks if the output delay of the rule is the same for every state.
+		 * If all the rules of a scenario share a constant delay, the scenario can be simulated synchronously.
+		 * Its argument is set to the output delay if the output delay is constant.
+		 * By default, output delays are not constant, and the argument is not modified.
+		 * @return true if the output delay is constant.
+		 */
+		virtual bool constantDelay(T&) const {
+			return false;
+		}
+	};
+
+	template <typename S, typename V, typename T = double>
+	using denseGridRuleFactory = std::shared_ptr<DenseGridRule<S, V, T>>(*)(const std::shared_ptr<const GridCellConfig<S, V>>& cellConfig);
+
+	/**
+	 * @brief Dense simulation engine for grid Cell-DEVS scenarios.
+	 *
+	 * It reads the same JSON configuration files as the GridCellDEVSCoupled class, but it does not build one atomic
+	 * model per cell. Cell states are stored in contiguous arrays indexed by the linear index of the cells, and
+	 * neighborhoods are stencils of integer offsets. Next output times are kept in a calendar queue, and every
+	 * simulation step only visits the cells that output their state and their neighbors. The rule factory is called
+	 * once per cell configuration (instead of once per cell). Cells behave exactly as grid cells with inertial delays.
+	 * External couplings and other delay types are not supported.
+	 *
+	 * If all the rules declare the same constant output delay, the scenario behaves as a synchronous cellular automaton:
+	 * cells only output their state every delay time units. In this case, the calendar queue is replaced by a list of
+	 * the cells that changed in the previous step, and the local computations of every step run as a double-buffered
+	 * sweep over the active cells. When compiled with OpenMP, large sweeps are split in tiles of consecutive cells that
+	 * run in parallel. Small sweeps run in the calling thread, as waking up the thread team would cost more.
+	 * Synchronous simulations produce the same results as event-driven simulations. The "synchronous" field of the
+	 * scenario configuration disables (false) or requires (true) the synchronous mode.
+	 * @tparam S the type used for representing a cell state.
+	 * @tparam V the type used for representing a neighboring cell's vicinities.
+	 * @tparam T the type used for representing the simulation time. By default, it is double.
+	 */
+	template <typename S, typename V, typename T = double>
+	class DenseGridCellDEVS {
+	 protected:
+		//! Pre-processed cell configuration.
+		struct DenseConfig {
+			std::shared_ptr<const GridCellConfig<S, V>> config;     //!< Pointer to the cell configuration.
+			std::shared_ptr<const DenseGridRule<S, V, T>> rule;     //!< Pointer to the rule of the cells.
+			std::vector<std::pair<std::size_t, V>> relative;        //!< Pairs <index of distance vector, vicinity>.
+			std::vector<std::pair<std::size_t, V>> absolute;        //!< Pairs <linear index of neighbor, vicinity>.
+		};
+
+		std::string id;                                  //!< ID of the scenario (used for logging).
+		nlohmann::json rawConfig;                        //!< JSON configuration file.
+		std::shared_ptr<GridScenario> scenario;          //!< Pointer to the scenario configuration.
+		denseGridRuleFactory<S, V, T> factory;           //!< Pointer to the rule factory function.
+		T width;                                         //!< Width of the buckets of the calendar queue.
+		std::vector<DenseConfig> configs;                //!< Cell configurations. The first one is the default one.
+		std::shared_ptr<GridStencil> stencil;            //!< Union of the relative neighborhoods of all the configurations.
+		std::vector<char> member;                        //!< member[k * configs.size() + c] is true if configuration c uses distance k.
+		//! For every absolute neighbor, the cells that have it in their neighborhood.
+		std::unordered_map<std::size_t, std::vector<std::size_t>> absoluteReceivers;
+		std::vector<std::uint32_t> configIndex;          //!< Cell configuration of every cell.
+		std::vector<S> states;                           //!< Current state of every cell.
+		std::vector<S> pending;                          //!< State that every cell will output next.
+		std::vector<S> published;                        //!< Latest state output by every cell.
+		CalendarQueue<T> queue;                          //!< Calendar queue with the next output time of every cell.
+		T timeLast;                                      //!< Time of the last simulation step.
+		std::shared_ptr<Logger> logger;                  //!< Pointer to simulation logger.
+		std::vector<std::size_t> imminent;               //!< Buffer with the cells that output their state in a step.
+		std::vector<std::size_t> active;                 //!< Buffer with the cells that change in a step.
+		std::vector<char> flags;                         //!< For every cell, its role in the current step.
+		std::vector<std::pair<std::size_t, const V*>> neighbors;  //!< Buffer with the neighborhood of a cell.
+		bool synchronous;                                //!< If true, the scenario is simulated synchronously.
+		T delay;                                         //!< Output delay of all the cells in synchronous simulations.
+		T syncTime;                                      //!< Time of the next step in synchronous simulations.
+		bool initialStep;                                //!< It is true until the cells output their initial state.
+
+		static constexpr char IMMINENT = 1;  //!< Flag of cells that output their state in the current step.
+		static constexpr char RECEIVER = 2;  //!< Flag of cells that receive new neighbor states in the current step.
+		static constexpr char CHANGED = 4;   //!< Flag of cells whose state changes in the current synchronous step.
+		static constexpr long PARALLEL_SWEEP = 1024;  //!< Minimum number of active cells for sweeping them in parallel.
+
+		/**
+		 * It generates a cell configuration from a default configuration and a patch.
+		 * @param configId ID of the cell configuration.
+		 * @param cellConfig default configuration (JSON object).
+		 * @param patch patch to be applied to the default configuration (JSON object).
+		 */
+		void loadCellConfig(const std::string& configId, const nlohmann::json& cellConfig, const nlohmann::json& patch) {
+			auto copyConfig = nlohmann::json::parse(cellConfig.dump());
+			copyConfig.merge_patch(patch);
+			auto config = std::make_shared<const GridCellConfig<S, V>>(configId, copyConfig, scenario);
+			if (config->delayType != "inertial") {
+				throw CadmiumModelException("dense grid Cell-DEVS scenarios only support inertial delays");
+			}
+			if (!config->EIC.empty() || !config->EOC.empty()) {
+				throw CadmiumModelException("dense grid Cell-DEVS scenarios do not support external couplings");
+			}
+			configs.push_back({config, factory(config), {}, {}});
+		}
+
+		//! It reads the JSON file and loads all the cell configurations. The default configuration goes first.
+		void loadCellConfigs() {
+			auto rawConfigs = rawConfig.contains("cells") ? rawConfig["cells"] : nlohmann::json::object();
+			auto rawDefault = (rawConfigs.contains("default")) ? rawConfigs["default"] : nlohmann::json::object();
+			loadCellConfig("default", rawDefault, nlohmann::json::object());
+			for (auto const& [configId, patch]: rawConfigs.items()) {
+				if (configId != "default") {
+					loadCellConfig(configId, rawDefault, patch);
+				}
+			}
+		}
+
+		/**
+		 * It checks if all the rules share a constant output delay and selects the simulation mode accordingly.
+		 * @throw CadmiumModelException if the synchronous mode is required but the output delays are not constant.
+		 */
+		void checkSynchronous() {
+			const auto& rawScenario = rawConfig.at("scenario");
+			synchronous = !rawScenario.contains("synchronous") || rawScenario["synchronous"].get<bool>();
+			for (std::size_t c = 0; synchronous && c < configs.size(); ++c) {
+				T ruleDelay;
+				synchronous = configs[c].rule->constantDelay(ruleDelay) && (c == 0 || ruleDelay == delay);
+				if (synchronous) {
+					delay = ruleDelay;
+				}
+			}
+			if (!synchronous && rawScenario.contains("synchronous") && rawScenario["synchronous"].get<bool>()) {
+				throw CadmiumModelException("synchronous simulation requires the same constant output delay in all the cells");
+			}
+		}
+
+		//! It builds the stencil with the relative neighborhoods of all the configurations.
+		void buildStencil() {
+			std::vector<coordinates> distances;
+			std::unordered_map<coordinates, std::size_t> distanceIndex;
+			for (auto& config: configs) {
+				for (const auto& [distance, neighborData]: config.config->relative) {
+					auto it = distanceIndex.find(distance);
+					if (it == distanceIndex.end()) {
+						it = distanceIndex.emplace(distance, distances.size()).first;
+						distances.push_back(distance);
+					}
+					config.relative.emplace_back(it->second, neighborData.vicinity);
+				}
+				std::sort(config.relative.begin(), config.relative.end(), [](const auto& a, const auto& b) {
+					return a.first < b.first;
+				});
+			}
+			stencil = std::make_shared<GridStencil>(*scenario, distances);
+			member = std::vector<char>(distances.size() * configs.size());
+			for (std::size_t c = 0; c < configs.size(); ++c) {
+				for (const auto& [k, vicinity]: configs[c].relative) {
+					member[k * configs.size() + c] = true;
+				}
+			}
+		}
+
+		//! It assigns a configuration to every cell and sets the initial state of the cells.
+		void buildCells() {
+			auto nCells = stencil->nCells();
+			configIndex = std::vector<std::uint32_t>(nCells, 0);
+			for (std::uint32_t c = 1; c < configs.size(); ++c) {
+				for (const auto& cellId: configs[c].config->cellMap) {
+					auto cell = stencil->cellIndex(cellId);
+					if (configIndex[cell] != 0) {
+						throw CadmiumModelException("cell with more than one configuration");
+					}
+					configIndex[cell] = c;
+				}
+			}
+			states.reserve(nCells);
+			for (std::size_t cell = 0; cell < nCells; ++cell) {
+				states.push_back(configs[configIndex[cell]].config->state);
+			}
+			pending = states;
+			published = states;
+			for (std::size_t c = 0; c < configs.size(); ++c) {
+				for (const auto& [neighborId, neighborData]: configs[c].config->absolute) {
+					configs[c].absolute.emplace_back(stencil->cellIndex(neighborId), neighborData.vicinity);
+				}
+				if (!configs[c].absolute.empty()) {
+					for (std::size_t cell = 0; cell < nCells; ++cell) {
+						if (configIndex[cell] == c) {
+							for (const auto& [neighbor, vicinity]: configs[c].absolute) {
+								absoluteReceivers[neighbor].push_back(cell);
+							}
+						}
+					}
+				}
+			}
+			// As regular cells, all the cells output their initial state at the beginning of the simulation
+			initialStep = true;
+			imminent.clear();
+			if (synchronous) {
+				for (std::size_t cell = 0; cell < nCells; ++cell) {
+					imminent.push_back(cell);
+				}
+				syncTime = timeLast;
+			} else {
+				queue = CalendarQueue<T>(nCells, width, 1);
+				for (std::size_t cell = 0; cell < nCells; ++cell) {
+					queue.schedule(cell, timeLast);
+				}
+			}
+			flags = std::vector<char>(nCells);
+		}
+
+		/**
+		 * It fills a buffer with the neighborhood of a cell.
+		 * Neighbors that appear twice (e.g., in small wrapped scenarios) are only considered once.
+		 * Absolute neighbors override the vicinity of relative neighbors.
+		 * @param cell linear index of the cell.
+		 * @param neighbors buffer to be filled with pairs <neighbor index, vicinity>.
+		 */
+		void buildNeighborhood(std::size_t cell, std::vector<std::pair<std::size_t, const V*>>& neighbors) const {
+			const auto& config = configs[configIndex[cell]];
+			auto interior = stencil->isInterior(cell);
+			neighbors.clear();
+			for (const auto& [k, vicinity]: config.relative) {
+				std::size_t neighbor;
+				if (stencil->cellTo(cell, k, interior, neighbor)) {
+					if (interior || std::none_of(neighbors.begin(), neighbors.end(), [neighbor](const auto& n) { return n.first == neighbor; })) {
+						neighbors.emplace_back(neighbor, &vicinity);
+					}
+				}
+			}
+			for (const auto& [neighbor, vicinity]: config.absolute) {
+				auto it = std::find_if(neighbors.begin(), neighbors.end(), [neighbor](const auto& n) { return n.first == neighbor; });
+				if (it == neighbors.end()) {
+					neighbors.emplace_back(neighbor, &vicinity);
+				} else {
+					it->second = &vicinity;
+				}
+			}
+		}
+
+		/**
+		 * It adds a cell to the active buffer.
+		 * @param cell linear index of the cell.
+		 * @param flag role of the cell in the current step.
+		 */
+		void activate(std::size_t cell, char flag) {
+			if (flags[cell] == 0) {
+				active.push_back(cell);
+			}
+			flags[cell] |= flag;
+		}
+
+		/**
+		 * It adds to the active buffer all the cells that have a given cell in their neighborhood.
+		 * @param cell linear index of the cell that outputs its state.
+		 */
+		void activateReceivers(std::size_t cell) {
+			auto interior = stencil->isInterior(cell);
+			auto nConfigs = configs.size();
+			for (std::size_t k = 0; k < stencil->size(); ++k) {
+				std::size_t receiver;
+				if (stencil->cellFrom(cell, k, interior, receiver) && member[k * nConfigs + configIndex[receiver]]) {
+					activate(receiver, RECEIVER);
+				}
+			}
+			if (!absoluteReceivers.empty()) {
+				auto it = absoluteReceivers.find(cell);
+				if (it != absoluteReceivers.end()) {
+					for (auto receiver: it->second) {
+						activate(receiver, RECEIVER);
+					}
+				}
+			}
+		}
+
+		/**
+		 * It logs the state of a cell.
+		 * @param time current simulation time.
+		 * @param cell position of the cell in the state arrays (i.e., its linear index).
+		 */
+		virtual void logState(T time, std::size_t cell) {
+			std::stringstream ss;
+			ss << states[cell];
+			logger->logState(TimeTraits<T>::toDouble(time), static_cast<long>(cell), cellId(cell), ss.str());
+		}
+
+		//! @return time of the next simulation step.
+		[[nodiscard]] virtual T nextTime() {
+			if (synchronous) {
+				return imminent.empty() ? TimeTraits<T>::infinity() : syncTime;
+			}
+			return queue.nextTime();
+		}
+
+		/**
+		 * Imminent cells publish their pending state. Then, they and their receivers are added to the active buffer.
+		 * With active frontiers, cells do not publish their pending state if it is equal to their published state.
+		 * @param time current simulation time.
+		 */
+		void publishImminent(T time) {
+			std::size_t nPublished = 0;
+			for (auto cell: imminent) {
+				activate(cell, IMMINENT);
+				if (initialStep || !configs[configIndex[cell]].config->activeFrontier || pending[cell] != published[cell]) {
+					published[cell] = pending[cell];
+					imminent[nPublished++] = cell;  // imminent cells that actually publish are moved to the front
+					if (logger != nullptr) {
+						std::stringstream ss;
+						ss << published[cell];
+						logger->logOutput(TimeTraits<T>::toDouble(time), static_cast<long>(cell), cellId(cell), "outputNeighborhood", ss.str());
+					}
+				}
+			}
+			for (std::size_t i = 0; i < nPublished; ++i) {
+				activateReceivers(imminent[i]);
+			}
+			initialStep = false;
+		}
+
+		/**
+		 * It runs a simulation step.
+		 * @param time simulation time of the step. It must be the time of the next events of the calendar queue.
+		 */
+		virtual void simulationAdvance(T time) {
+			if (synchronous) {
+				synchronousAdvance(time);
+				return;
+			}
+			if (logger != nullptr) {
+				logger->logTime(TimeTraits<T>::toDouble(time));
+			}
+			imminent.clear();
+			active.clear();
+			queue.pop(imminent);
+			std::sort(imminent.begin(), imminent.end());
+			// Output: imminent cells publish their pending state
+			publishImminent(time);
+			// Transition: cells that received new neighbor states compute their next state
+			std::sort(active.begin(), active.end());
+			for (auto cell: active) {
+				if (flags[cell] & RECEIVER) {
+					buildNeighborhood(cell, neighbors);
+					const auto& rule = *configs[configIndex[cell]].rule;
+					auto nextState = rule.localComputation(states[cell], DenseNeighborhood<S, V>(published, neighbors));
+					if (nextState != states[cell]) {
+						queue.schedule(cell, time + rule.outputDelay(nextState));
+						pending[cell] = nextState;
+					}
+					states[cell] = std::move(nextState);
+				}
+				flags[cell] = 0;
+				if (logger != nullptr) {
+					logState(time, cell);
+				}
+			}
+			timeLast = time;
+		}
+
+		/**
+		 * It runs a synchronous simulation step. The imminent cells are the ones that changed in the previous step.
+		 * @param time simulation time of the step. It must be the result of nextTime().
+		 */
+		void synchronousAdvance(T time) {
+			if (logger != nullptr) {
+				logger->logTime(TimeTraits<T>::toDouble(time));
+			}
+			active.clear();
+			// Output: imminent cells publish their pending state
+			publishImminent(time);
+			imminent.clear();
+			// Transition: receivers only read published states, so they are swept in parallel tiles of consecutive cells
+			std::sort(active.begin(), active.end());
+			auto nActive = static_cast<long>(active.size());
+			std::exception_ptr error;
+#ifdef _OPENMP
+			#pragma omp parallel if(nActive >= PARALLEL_SWEEP)
+#endif
+			{
+				std::vector<std::pair<std::size_t, const V*>> buffer;
+#ifdef _OPENMP
+				#pragma omp for schedule(static)
+#endif
+				for (long i = 0; i < nActive; ++i) {
+					auto cell = active[i];
+					if (flags[cell] & RECEIVER) {
+						try {
+							buildNeighborhood(cell, buffer);
+							const auto& rule = *configs[configIndex[cell]].rule;
+							auto nextState = rule.localComputation(states[cell], DenseNeighborhood<S, V>(published, buffer));
+							if (nextState != states[cell]) {
+								pending[cell] = nextState;
+								flags[cell] |= CHANGED;
+							}
+							states[cell] = std::move(nextState);
+						} catch (...) {
+#ifdef _OPENMP
+							#pragma omp critical
+#endif
+							error = std::current_exception();
+						}
+					}
+				}
+			}
+			if (error) {
+				std::rethrow_exception(error);
+			}
+			// Cells that changed output their new state in the next step
+			for (auto cell: active) {
+				if (flags[cell] & CHANGED) {
+					imminent.push_back(cell);
+				}
+				flags[cell] = 0;
+				if (logger != nullptr) {
+					logState(time, cell);
+				}
+			}
+			timeLast = time;
+			syncTime = time + delay;
+		}
+	 public:
+		/**
+		 * Constructor function. It reads the configuration file, but it does not build the scenario.
+		 * @param id ID of the dense grid Cell-DEVS scenario.
+		 * @param factory pointer to the rule factory function. It is called once per cell configuration.
+		 * @param configFilePath path to the scenario configuration file.
+		 * @param width width of the buckets of the calendar queue. It should be similar to the usual output delay.
+		 */
+		DenseGridCellDEVS(std::string id, denseGridRuleFactory<S, V, T> factory, const std::string& configFilePath, T width = T(1)):
+		  id(std::move(id)), rawConfig(), scenario(), factory(factory), width(width), configs(), stencil(), member(),
+		  absoluteReceivers(), configIndex(), states(), pending(), published(), queue(0, width, 1),
+		  timeLast(TimeTraits<T>::zero()), logger(), imminent(), active(), flags(), neighbors(),
+		  synchronous(), delay(), syncTime(TimeTraits<T>::infinity()), initialStep() {
+			std::ifstream i(configFilePath);
+			i >> rawConfig;
+			nlohmann::json rawScenario = rawConfig.at("scenario");
+			auto shape = rawScenario.at("shape").get<coordinates>();
+			auto origin = rawScenario.contains("origin")? rawScenario["origin"].get<coordinates>() : coordinates(shape.size(), 0);
+			auto wrapped = rawScenario.contains("wrapped") && rawScenario["wrapped"].get<bool>();
+			scenario = std::make_shared<GridScenario>(shape, origin, wrapped);
+		}
+
+		virtual ~DenseGridCellDEVS() = default;
+
+		//! It builds the dense grid Cell-DEVS scenario.
+		virtual void buildModel() {
+			loadCellConfigs();
+			checkSynchronous();
+			buildStencil();
+			buildCells();
+		}
+
+		//! @return ID of the dense grid Cell-DEVS scenario.
+		[[nodiscard]] const std::string& getId() const {
+			return id;
+		}
+
+		//! @return number of cells of the scenario.
+		[[nodiscard]] std::size_t size() const {
+			return (stencil == nullptr) ? 0 : stencil->nCells();
+		}
+
+		/**
+		 * @param cell coordinates of a cell.
+		 * @return linear index of the cell.
+		 */
+		[[nodiscard]] std::size_t cellIndex(const coordinates& cell) const {
+			return stencil->cellIndex(cell);
+		}
+
+		/**
+		 * @param cell linear index of a cell.
+		 * @return string representation of the cell ID (the same as the ID of cells in GridCellDEVSCoupled models).
+		 */
+		[[nodiscard]] std::string cellId(std::size_t cell) const {
+			std::stringstream ss;
+			ss << stencil->cellCoordinates(cell);
+			return ss.str();
+		}
+
+		/**
+		 * @param cell linear index of a cell.
+		 * @return constant reference to the current state of the cell.
+		 */
+		[[nodiscard]] virtual const S& getState(std::size_t cell) const {
+			return states.at(cell);
+		}
+
+		/**
+		 * @param cell coordinates of a cell.
+		 * @return constant reference to the current state of the cell.
+		 */
+		[[nodiscard]] const S& getState(const coordinates& cell) const {
+			return getState(cellIndex(cell));
+		}
+
+		//! @return time of the last simulation step.
+		[[nodiscard]] T getTimeLast() const {
+			return timeLast;
+		}
+
+		/**
+		 * It sets the logger. Every cell is logged as a model whose ID is its linear index.
+		 * @param log pointer to the new logger.
+		 */
+		void setLogger(const std::shared_ptr<Logger>& log) {
+			logger = log;
+		}
+
+		void start() {
+			if (logger != nullptr) {
+				logger->start();
+				for (std::size_t cell = 0; cell < states.size(); ++cell) {
+					logState(timeLast, cell);
+				}
+			}
+		}
+
+		void stop() {
+			if (logger != nullptr) {
+				for (std::size_t cell = 0; cell < states.size(); ++cell) {
+					logState(timeLast, cell);
+				}
+				logger->stop();
+			}
+		}
+
+		[[maybe_unused]] void simulate(long nIterations) {
+			T timeNext = nextTime();
+			while (nIterations-- > 0 && timeNext < TimeTraits<T>::infinity()) {
+				simulationAdvance(timeNext);
+				timeNext = nextTime();
+			}
+		}
+
+		[[maybe_unused]] void simulate(T timeInterval) {
+			T timeNext = nextTime();
+			T timeFinal = timeLast + timeInterval;
+			while (timeNext < timeFinal) {
+				simulationAdvance(timeNext);
+				timeNext = nextTime();
+			}
+		}
+	};
+}  //namespace cadmium::celldevs
+
+#endif //CADMIUM_CELLDEVS_GRID_DENSE_HPP_
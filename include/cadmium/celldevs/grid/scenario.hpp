@@ -11,7 +11,9 @@
 #define CADMIUM_CELLDEVS_GRID_SCENARIO_HPP_
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <numeric>
 #include <utility>
 #include <vector>
@@ -19,12 +21,113 @@
 #include "../../core/exception.hpp"
 
 namespace cadmium::celldevs {
+	/**
+	 * It computes the number of distance vectors of a Moore neighborhood (including the distance vector of the cell itself).
+	 * @param nDims number of dimensions of the neighborhood.
+	 * @param range range of the neighborhood.
+	 * @return number of distance vectors of the neighborhood.
+	 */
+	constexpr std::size_t mooreStencilSize(std::size_t nDims, int range) {
+		std::size_t size = 1;
+		for (std::size_t d = 0; d < nDims; ++d) {
+			size *= 2 * range + 1;
+		}
+		return size;
+	}
+
+	/**
+	 * It computes the i-th distance vector of a Moore neighborhood.
+	 * Distance vectors follow the iteration order of grid scenarios (i.e., the first dimension changes faster).
+	 * @tparam N number of dimensions of the neighborhood.
+	 * @tparam R range of the neighborhood.
+	 * @param i index of the distance vector.
+	 * @return the i-th distance vector of the neighborhood.
+	 */
+	template <std::size_t N, int R>
+	constexpr std::array<int, N> mooreStencilDistance(std::size_t i) {
+		std::array<int, N> distance{};
+		for (std::size_t d = 0; d < N; ++d) {
+			distance[d] = static_cast<int>(i % (2 * R + 1)) - R;
+			i /= 2 * R + 1;
+		}
+		return distance;
+	}
+
+	/**
+	 * It computes the number of distance vectors of a von Neumann neighborhood (including the distance vector of the cell itself).
+	 * @tparam N number of dimensions of the neighborhood.
+	 * @tparam R range of the neighborhood.
+	 * @return number of distance vectors of the neighborhood.
+	 */
+	template <std::size_t N, int R>
+	constexpr std::size_t vonNeumannStencilSize() {
+		std::size_t size = 0;
+		for (std::size_t i = 0; i < mooreStencilSize(N, R); ++i) {
+			int manhattan = 0;
+			for (auto v: mooreStencilDistance<N, R>(i)) {
+				manhattan += (v < 0) ? -v : v;
+			}
+			size += (manhattan <= R) ? 1 : 0;
+		}
+		return size;
+	}
+
+	/**
+	 * It generates at compile time all the distance vectors of a Moore neighborhood (see https://en.wikipedia.org/wiki/Moore_neighborhood).
+	 * The result is a constant expression, so loops over the neighborhood have a fixed trip count and do not allocate memory.
+	 * Distance vectors are sorted as in GridScenario::mooreNeighborhood.
+	 * @tparam N number of dimensions of the neighborhood. It must be greater than 0.
+	 * @tparam R range of the neighborhood. It must be greater than 0.
+	 * @return array with the distance vectors of the neighborhood.
+	 */
+	template <std::size_t N, int R = 1>
+	constexpr std::array<std::array<int, N>, mooreStencilSize(N, R)> mooreStencil() {
+		static_assert(N > 0, "number of dimensions must be greater than 0");
+		static_assert(R > 0, "range must be greater than 0");
+		std::array<std::array<int, N>, mooreStencilSize(N, R)> stencil{};
+		for (std::size_t i = 0; i < stencil.size(); ++i) {
+			stencil[i] = mooreStencilDistance<N, R>(i);
+		}
+		return stencil;
+	}
+
+	/**
+	 * It generates at compile time all the distance vectors of a von Neumann neighborhood (see https://en.wikipedia.org/wiki/Von_Neumann_neighborhood).
+	 * The result is a constant expression, so loops over the neighborhood have a fixed trip count and do not allocate memory.
+	 * Distance vectors are sorted as in GridScenario::vonNeumannNeighborhood.
+	 * @tparam N number of dimensions of the neighborhood. It must be greater than 0.
+	 * @tparam R range of the neighborhood. It must be greater than 0.
+	 * @return array with the distance vectors of the neighborhood.
+	 */
+	template <std::size_t N, int R = 1>
+	constexpr std::array<std::array<int, N>, vonNeumannStencilSize<N, R>()> vonNeumannStencil() {
+		static_assert(N > 0, "number of dimensions must be greater than 0");
+		static_assert(R > 0, "range must be greater than 0");
+		std::array<std::array<int, N>, vonNeumannStencilSize<N, R>()> stencil{};
+		std::size_t k = 0;
+		for (std::size_t i = 0; i < mooreStencilSize(N, R); ++i) {
+			auto distance = mooreStencilDistance<N, R>(i);
+			int manhattan = 0;
+			for (auto v: distance) {
+				manhattan += (v < 0) ? -v : v;
+			}
+			if (manhattan <= R) {
+				stencil[k++] = distance;
+			}
+		}
+		return stencil;
+	}
+
 	/**
 	 * @brief Auxiliary struct for grid-like Cadmium Cell-DEVS models.
 	 *
 	 * This struct contains useful functions for these scenarios (e.g., computing distances between cells).
+	 * @tparam N number of dimensions of the scenario. If it is 0, the number of dimensions is only known at runtime.
 	 */
-	struct GridScenario {
+	template <std::size_t N>
+	struct BasicGridScenario {
+		using coordinates = gridCoordinates<N>;  //!< Type used for representing cell coordinates in the scenario.
+
 		const coordinates shape;   //!< shape of the scenarios (i.e., how many cells are in the scenario by dimension).
 		const coordinates origin;  //!< coordinates of the origin cell. In 2D scenarios, it corresponds to the upper-left cell.
 		const bool wrapped;        //!< if true, the scenario is wrapped.
@@ -35,7 +138,7 @@ namespace cadmium::celldevs {
 		 * @param origin coordinates of the origin cell. The size must be equal to the size of the shape.
 		 * @param wrapped it determines whether or not the grid Cell-DEVS scenario is wrapped.
 		 */
-		GridScenario(const coordinates& shape, const coordinates& origin, bool wrapped): shape(shape), origin(origin), wrapped(wrapped) {
+		BasicGridScenario(const coordinates& shape, const coordinates& origin, bool wrapped): shape(shape), origin(origin), wrapped(wrapped) {
 			if (shape.empty()) {
 				throw CadmiumModelException("invalid scenario shape");
 			}
@@ -80,13 +183,13 @@ namespace cadmium::celldevs {
 			if (!cellInScenario(cellFrom) || !cellInScenario(cellTo)) {
 				throw CadmiumModelException("Cell does not belong to scenario");
 			}
-			coordinates distance;
+			auto distance = filledCoordinates<N>(shape.size(), 0);
 			for (int i = 0; i < shape.size(); ++i) {
 				auto d = cellTo[i] - cellFrom[i];
 				if (wrapped && abs(d) > shape[i] / 2) {
 					d -= (int) copysign(shape[i], d);
 				}
-				distance.push_back(d);
+				distance[i] = d;
 			}
 			if (!validDistance(distance)) {
 				throw CadmiumModelException("Invalid distance vector");
@@ -107,13 +210,13 @@ namespace cadmium::celldevs {
 			if (!validDistance(distance)) {
 				throw CadmiumModelException("Invalid distance vector");
 			}
-			coordinates cellTo;
+			auto cellTo = filledCoordinates<N>(shape.size(), 0);
 			for (int i = 0; i < shape.size(); ++i) {
 				auto v = cellFrom[i] + distance[i];
 				if (wrapped) {
-					v = (v + shape[i]) % shape[i];
+					v = ((v - origin[i]) % shape[i] + shape[i]) % shape[i] + origin[i];
 				}
-				cellTo.push_back(v);
+				cellTo[i] = v;
 			}
 			if (!cellInScenario(cellTo)) {
 				throw CadmiumModelException("Cell does not belong to scenario");
@@ -134,13 +237,13 @@ namespace cadmium::celldevs {
 			if (!cellInScenario(cellTo)) {
 				throw CadmiumModelException("Cell does not belong to scenario");
 			}
-			coordinates cellFrom;
+			auto cellFrom = filledCoordinates<N>(shape.size(), 0);
 			for (int i = 0; i < shape.size(); ++i) {
 				auto v = cellTo[i] - distance[i];
 				if (wrapped) {
-					v = (v + shape[i]) % shape[i];
+					v = ((v - origin[i]) % shape[i] + shape[i]) % shape[i] + origin[i];
 				}
-				cellFrom.push_back(v);
+				cellFrom[i] = v;
 			}
 			if (!cellInScenario(cellFrom)) {
 				throw CadmiumModelException("Cell does not belong to scenario");
@@ -179,6 +282,30 @@ namespace cadmium::celldevs {
 			return chebyshevDistance(distanceVector(cellFrom, cellTo));
 		}
 
+		/**
+		 * It compares two cells according to their position in the Z-order curve of the scenario (see https://en.wikipedia.org/wiki/Z-order_curve).
+		 * Cells that are close in the curve are close in the scenario. Morton codes are not computed, so the comparison
+		 * does not overflow regardless of the shape of the scenario. In ties, the last dimension is the most significant.
+		 * @param a coordinates of the first cell.
+		 * @param b coordinates of the second cell.
+		 * @return true if the first cell precedes the second one in the Z-order curve.
+		 */
+		[[nodiscard]] bool mortonPrecedes(const coordinates& a, const coordinates& b) const {
+			if (!cellInScenario(a) || !cellInScenario(b)) {
+				throw CadmiumModelException("Cell does not belong to scenario");
+			}
+			std::size_t msd = 0;  // the most significant dimension is the one with the highest differing bit
+			unsigned int msb = 0;
+			for (std::size_t d = 0; d < shape.size(); ++d) {
+				auto diff = static_cast<unsigned int>(a[d] - origin[d]) ^ static_cast<unsigned int>(b[d] - origin[d]);
+				if (!(diff < msb && diff < (diff ^ msb))) {  // the highest bit of diff is not lower than that of msb
+					msd = d;
+					msb = diff;
+				}
+			}
+			return a[msd] < b[msd];
+		}
+
 		/**
 		 * It computes the Minkowski distance from a distance vector.
 		 * @param p order to be applied when computing the Minkowski distance. It must be greater than 0.
@@ -263,28 +390,29 @@ namespace cadmium::celldevs {
 		 * @param range range of the Moore neighborhood. It must be greater than 0.
 		 * @return Moore scenario of the desired range.
 		 */
-		[[nodiscard]] GridScenario mooreScenario(int range) const {
+		[[nodiscard]] BasicGridScenario<N> mooreScenario(int range) const {
 			if (range < 1) {
 				throw CadmiumModelException("range must be greater than 0");
 			}
-			auto nShape = coordinates(shape.size(), 2 * range + 1);
-			auto nOrigin = coordinates(shape.size(), -range);
+			auto nShape = filledCoordinates<N>(shape.size(), 2 * range + 1);
+			auto nOrigin = filledCoordinates<N>(shape.size(), -range);
 			return {nShape, nOrigin, false};
 		}
 
 		//! Auxiliary class for iterating over all the cells within the grid scenario.
 		class Iterator {
-			const GridScenario *scenario;  //!< Pointer to the corresponding grid scenario.
-			coordinates cell;         //!< latest cell coordinate computed by the iterator.
+			const BasicGridScenario<N> *scenario;  //!< Pointer to the corresponding grid scenario.
+			coordinates cell;                      //!< latest cell coordinate computed by the iterator.
+			bool consumed;                         //!< if true, the iterator is done with all the cells in the scenario.
 
 			/**
 			 * It computes the coordinates of the next cell to be iterated.
-			 * Once the iterator is done with all the cells in the scenario, it sets cell to an empty vector.
+			 * Once the iterator is done with all the cells in the scenario, it sets consumed to true.
 			 * @param d dimension being explored. Usually, it is set to 0 (i.e., the first dimension).
 			 */
 			void next(int d) {
 				if (d < 0 || d >= cell.size()) {
-					cell = {};
+					consumed = true;
 				} else if (cell[d] - scenario->origin[d] < scenario->shape[d] - 1) {
 					cell[d]++;
 				} else {
@@ -298,16 +426,18 @@ namespace cadmium::celldevs {
 			 * Iterator constructor.
 			 * @param scenario pointer to the scenario being iterated.
 			 * @param cell first cell coordinate (usually, the scenario origin cell).
+			 * @param consumed if true, the iterator is already done with all the cells in the scenario.
 			 */
-			Iterator(const GridScenario *scenario, coordinates cell): scenario(scenario), cell(std::move(cell)) {
-				if (!(this->cell.empty() || scenario->cellInScenario(this->cell))) {
+			Iterator(const BasicGridScenario<N> *scenario, coordinates cell, bool consumed = false):
+			  scenario(scenario), cell(std::move(cell)), consumed(consumed) {
+				if (!(consumed || scenario->cellInScenario(this->cell))) {
 					throw CadmiumModelException("Invalid iterator");
 				}
 			}
 
 			//! Two iterators are different if the point to different scenarios or if the current cell is different.
 			bool operator!=(const Iterator& b) const {
-				return scenario != b.scenario || cell != b.cell;
+				return scenario != b.scenario || consumed != b.consumed || (!consumed && cell != b.cell);
 			}
 
 			//! when updating the iterator, we just call the next method and return the same iterator.
@@ -327,11 +457,14 @@ namespace cadmium::celldevs {
 			return {this, origin};
 		}
 
-		//! @return a consumed iterator (i.e., it initially points to an empty vector).
+		//! @return a consumed iterator.
 		Iterator end() {
-			return {this, {}};
+			return {this, origin, true};
 		}
 	};
+
+	//! Grid scenario with a number of dimensions that is only known at runtime.
+	using GridScenario = BasicGridScenario<0>;
 }
 
 #endif //CADMIUM_CELLDEVS_GRID_SCENARIO_HPP_
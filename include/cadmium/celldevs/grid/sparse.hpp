@@ -0,0 +1,310 @@
+/**
+ * Sparse simulation engine for grid Cell-DEVS scenarios that instantiates cells lazily.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CELLDEVS_GRID_SPARSE_HPP_
+#define CADMIUM_CELLDEVS_GRID_SPARSE_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "dense.hpp"
+#include "utility.hpp"
+#include "../../core/exception.hpp"
+#include "../../core/modeling/time.hpp"
+#include "../../core/simulation/calendar_queue.hpp"
+
+namespace cadmium::celldevs {
+	/**
+	 * @brief Sparse simulation engine for grid Cell-DEVS scenarios that instantiates cells lazily.
+	 *
+	 * Cells with the default configuration are virtual: they are not stored, and their state is the default state.
+	 * A virtual cell is materialized (i.e., it gets a slot in the state arrays) the first time one of its neighbors
+	 * publishes a state that is different to the default state. Cells with other configurations are materialized
+	 * from the beginning. Thus, memory and start-up time scale with the number of cells that are touched during the
+	 * simulation instead of with the size of the scenario. The first slot of the state arrays always holds the
+	 * default state, and virtual neighbors are read from it.
+	 * The default state must be quiescent: a cell in the default state surrounded by cells in the default state
+	 * must remain in the default state. Then, simulations are equivalent to those of the DenseGridCellDEVS class,
+	 * but virtual cells are not logged. Synchronous simulations and absolute neighbors in the default
+	 * configuration are not supported.
+	 * @tparam S the type used for representing a cell state.
+	 * @tparam V the type used for representing a neighboring cell's vicinities.
+	 * @tparam T the type used for representing the simulation time. By default, it is double.
+	 */
+	template <typename S, typename V, typename T = double>
+	class SparseGridCellDEVS: public DenseGridCellDEVS<S, V, T> {
+	 private:
+		static constexpr std::size_t noCell = std::numeric_limits<std::size_t>::max();  //!< Cell of the default slot.
+
+		std::unordered_map<std::size_t, std::size_t> slots;  //!< Slot of every materialized cell.
+		std::vector<std::size_t> cells;                      //!< Linear index of the cell of every slot.
+		std::vector<std::size_t> neighborCells;              //!< Buffer with the linear indices of the neighbors of a cell.
+
+		//! It returns a comparator that sorts slots by the linear index of their cells.
+		[[nodiscard]] auto byCell() const {
+			return [this](std::size_t a, std::size_t b) { return cells[a] < cells[b]; };
+		}
+
+		/**
+		 * It materializes a cell.
+		 * @param cell linear index of the cell.
+		 * @param config index of the configuration of the cell.
+		 * @return slot of the new cell.
+		 * @throw CadmiumModelException if the cell is already materialized.
+		 */
+		std::size_t materialize(std::size_t cell, std::uint32_t config) {
+			auto slot = cells.size();
+			if (!slots.emplace(cell, slot).second) {
+				throw CadmiumModelException("cell with more than one configuration");
+			}
+			cells.push_back(cell);
+			this->configIndex.push_back(config);
+			this->states.push_back(this->configs[config].config->state);
+			this->pending.push_back(this->states.back());
+			this->published.push_back(this->states.back());
+			this->flags.push_back(0);
+			this->queue.addElement();
+			return slot;
+		}
+
+		/**
+		 * @param cell linear index of a cell.
+		 * @return slot of the cell. Virtual cells return the slot of the default state (i.e., 0).
+		 */
+		[[nodiscard]] std::size_t slotOf(std::size_t cell) const {
+			auto it = slots.find(cell);
+			return (it == slots.end()) ? 0 : it->second;
+		}
+
+		/**
+		 * It fills the neighbors buffer with the neighborhood of a materialized cell.
+		 * Neighbors are found in the same order as in DenseGridCellDEVS, so local computations are identical.
+		 * @param slot slot of the cell.
+		 */
+		void buildNeighborhood(std::size_t slot) {
+			auto cell = cells[slot];
+			const auto& config = this->configs[this->configIndex[slot]];
+			auto interior = this->stencil->isInterior(cell);
+			this->neighbors.clear();
+			neighborCells.clear();
+			for (const auto& [k, vicinity]: config.relative) {
+				std::size_t neighbor;
+				if (this->stencil->cellTo(cell, k, interior, neighbor)) {
+					if (interior || std::find(neighborCells.begin(), neighborCells.end(), neighbor) == neighborCells.end()) {
+						this->neighbors.emplace_back(slotOf(neighbor), &vicinity);
+						neighborCells.push_back(neighbor);
+					}
+				}
+			}
+			for (const auto& [neighbor, vicinity]: config.absolute) {
+				auto it = std::find(neighborCells.begin(), neighborCells.end(), neighbor);
+				if (it == neighborCells.end()) {
+					this->neighbors.emplace_back(slotOf(neighbor), &vicinity);
+					neighborCells.push_back(neighbor);
+				} else {
+					this->neighbors[it - neighborCells.begin()].second = &vicinity;
+				}
+			}
+		}
+
+		/**
+		 * It activates the cells that have a given cell in their neighborhood.
+		 * Virtual cells are materialized if the published state is different to the default state.
+		 * @param slot slot of the cell that publishes its state.
+		 */
+		void activateReceivers(std::size_t slot) {
+			auto cell = cells[slot];
+			auto differs = this->published[slot] != this->published[0];
+			auto interior = this->stencil->isInterior(cell);
+			auto nConfigs = this->configs.size();
+			for (std::size_t k = 0; k < this->stencil->size(); ++k) {
+				std::size_t receiver;
+				if (this->stencil->cellFrom(cell, k, interior, receiver)) {
+					auto receiverSlot = slotOf(receiver);
+					if (this->member[k * nConfigs + this->configIndex[receiverSlot]]) {
+						if (receiverSlot != 0) {
+							this->activate(receiverSlot, this->RECEIVER);
+						} else if (differs) {
+							this->activate(materialize(receiver, 0), this->RECEIVER);
+						}
+					}
+				}
+			}
+			if (!this->absoluteReceivers.empty()) {
+				auto it = this->absoluteReceivers.find(cell);
+				if (it != this->absoluteReceivers.end()) {
+					for (auto receiver: it->second) {
+						this->activate(slots.at(receiver), this->RECEIVER);  // cells with absolute neighbors are never virtual
+					}
+				}
+			}
+		}
+
+		/**
+		 * It materializes the cells with a configuration other than the default one.
+		 * @throw CadmiumModelException if the scenario is not valid for sparse simulation.
+		 */
+		void buildCells() {
+			const auto& defaultConfig = this->configs[0];
+			if (!defaultConfig.config->absolute.empty()) {
+				throw CadmiumModelException("sparse grid Cell-DEVS scenarios do not support absolute neighbors in the default configuration");
+			}
+			slots.clear();
+			cells = {noCell};
+			this->configIndex = {0};
+			this->states = {defaultConfig.config->state};
+			this->pending = this->states;
+			this->published = this->states;
+			this->flags = {0};
+			this->queue = CalendarQueue<T>(1, this->width, 1);
+			for (std::uint32_t c = 1; c < this->configs.size(); ++c) {
+				for (const auto& cellId: this->configs[c].config->cellMap) {
+					materialize(this->stencil->cellIndex(cellId), c);
+				}
+			}
+			for (std::uint32_t c = 1; c < this->configs.size(); ++c) {
+				for (const auto& [neighborId, neighborData]: this->configs[c].config->absolute) {
+					this->configs[c].absolute.emplace_back(this->stencil->cellIndex(neighborId), neighborData.vicinity);
+				}
+				for (const auto& cellId: this->configs[c].config->cellMap) {
+					for (const auto& [neighbor, vicinity]: this->configs[c].absolute) {
+						this->absoluteReceivers[neighbor].push_back(this->stencil->cellIndex(cellId));
+					}
+				}
+			}
+			// A cell in the default state surrounded by cells in the default state must remain in the default state
+			this->neighbors.clear();
+			for (const auto& [k, vicinity]: defaultConfig.relative) {
+				this->neighbors.emplace_back(0, &vicinity);
+			}
+			auto state = defaultConfig.rule->localComputation(this->states[0], DenseNeighborhood<S, V>(this->published, this->neighbors));
+			if (state != this->states[0]) {
+				throw CadmiumModelException("the default state of sparse grid Cell-DEVS scenarios must be quiescent");
+			}
+			// As regular cells, all the cells output their initial state at the beginning of the simulation
+			for (std::size_t slot = 1; slot < cells.size(); ++slot) {
+				this->queue.schedule(slot, this->timeLast);
+			}
+			this->initialStep = true;
+		}
+
+		void logState(T time, std::size_t slot) override {
+			if (slot != 0) {
+				std::stringstream ss;
+				ss << this->states[slot];
+				this->logger->logState(TimeTraits<T>::toDouble(time), static_cast<long>(cells[slot]), this->cellId(cells[slot]), ss.str());
+			}
+		}
+
+		/**
+		 * It runs a simulation step.
+		 * @param time simulation time of the step. It must be the time of the next events of the calendar queue.
+		 */
+		void simulationAdvance(T time) override {
+			if (this->logger != nullptr) {
+				this->logger->logTime(TimeTraits<T>::toDouble(time));
+			}
+			auto& imminent = this->imminent;
+			auto& active = this->active;
+			imminent.clear();
+			active.clear();
+			this->queue.pop(imminent);
+			std::sort(imminent.begin(), imminent.end(), byCell());
+			// Output: imminent cells publish their pending state
+			std::size_t nPublished = 0;
+			for (auto slot: imminent) {
+				this->activate(slot, this->IMMINENT);
+				if (this->initialStep || !this->configs[this->configIndex[slot]].config->activeFrontier || this->pending[slot] != this->published[slot]) {
+					this->published[slot] = this->pending[slot];
+					imminent[nPublished++] = slot;
+					if (this->logger != nullptr) {
+						std::stringstream ss;
+						ss << this->published[slot];
+						this->logger->logOutput(TimeTraits<T>::toDouble(time), static_cast<long>(cells[slot]), this->cellId(cells[slot]), "outputNeighborhood", ss.str());
+					}
+				}
+			}
+			if (this->initialStep) {
+				// Virtual cells also output their initial state, so materialized cells with neighbors receive it
+				for (std::size_t slot = 1; slot < cells.size(); ++slot) {
+					buildNeighborhood(slot);
+					if (!this->neighbors.empty()) {
+						this->activate(slot, this->RECEIVER);
+					}
+				}
+				this->initialStep = false;
+			}
+			for (std::size_t i = 0; i < nPublished; ++i) {
+				activateReceivers(imminent[i]);
+			}
+			// Transition: cells that received new neighbor states compute their next state
+			std::sort(active.begin(), active.end(), byCell());
+			for (auto slot: active) {
+				if (this->flags[slot] & this->RECEIVER) {
+					buildNeighborhood(slot);
+					const auto& rule = *this->configs[this->configIndex[slot]].rule;
+					auto nextState = rule.localComputation(this->states[slot], DenseNeighborhood<S, V>(this->published, this->neighbors));
+					if (nextState != this->states[slot]) {
+						this->queue.schedule(slot, time + rule.outputDelay(nextState));
+						this->pending[slot] = nextState;
+					}
+					this->states[slot] = std::move(nextState);
+				}
+				this->flags[slot] = 0;
+				if (this->logger != nullptr) {
+					logState(time, slot);
+				}
+			}
+			this->timeLast = time;
+		}
+	 public:
+		/**
+		 * Constructor function. It reads the configuration file, but it does not build the scenario.
+		 * @param id ID of the sparse grid Cell-DEVS scenario.
+		 * @param factory pointer to the rule factory function. It is called once per cell configuration.
+		 * @param configFilePath path to the scenario configuration file.
+		 * @param width width of the buckets of the calendar queue. It should be similar to the usual output delay.
+		 */
+		SparseGridCellDEVS(std::string id, denseGridRuleFactory<S, V, T> factory, const std::string& configFilePath, T width = T(1)):
+		  DenseGridCellDEVS<S, V, T>(std::move(id), factory, configFilePath, width), slots(), cells(), neighborCells() {}
+
+		/**
+		 * It builds the sparse grid Cell-DEVS scenario. Only the cells with non-default configurations are materialized.
+		 * @throw CadmiumModelException if the scenario is not valid for sparse simulation.
+		 */
+		void buildModel() override {
+			this->loadCellConfigs();
+			this->buildStencil();
+			buildCells();
+		}
+
+		//! @return number of materialized cells.
+		[[nodiscard]] std::size_t nMaterialized() const {
+			return slots.size();
+		}
+
+		/**
+		 * @param cell linear index of a cell.
+		 * @return constant reference to the current state of the cell. Virtual cells return the default state.
+		 */
+		[[nodiscard]] const S& getState(std::size_t cell) const override {
+			if (cell >= this->size()) {
+				throw CadmiumModelException("Cell does not belong to scenario");
+			}
+			return this->states[slotOf(cell)];
+		}
+		using DenseGridCellDEVS<S, V, T>::getState;
+	};
+}  //namespace cadmium::celldevs
+
+#endif //CADMIUM_CELLDEVS_GRID_SPARSE_HPP_
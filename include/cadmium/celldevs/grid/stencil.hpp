@@ -0,0 +1,205 @@
+/**
+ * Neighborhood stencils for dense grid Cell-DEVS scenarios.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CELLDEVS_GRID_STENCIL_HPP_
+#define CADMIUM_CELLDEVS_GRID_STENCIL_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+#include "scenario.hpp"
+#include "utility.hpp"
+#include "../../core/exception.hpp"
+
+namespace cadmium::celldevs {
+	/**
+	 * @brief Set of distance vectors applied to the cells of a grid scenario by their linear index.
+	 *
+	 * Cells are numbered from 0 to the number of cells minus one, following the iteration order of the scenario
+	 * (i.e., the first dimension is the one that changes faster). Each distance vector is also stored as an offset
+	 * between linear indices. Thus, cells that are far enough from the borders of the scenario (interior cells)
+	 * find their neighbors with a single sum. The remaining cells are checked dimension by dimension.
+	 */
+	class GridStencil {
+	 private:
+		coordinates shape;                   //!< Shape of the scenario.
+		coordinates origin;                  //!< Coordinates of the origin cell of the scenario.
+		bool wrapped;                        //!< If true, the scenario is wrapped.
+		std::vector<long> strides;           //!< Offset between linear indices of consecutive cells in every dimension.
+		std::vector<coordinates> distances;  //!< Distance vectors of the stencil.
+		std::vector<long> offsets;           //!< Offset between linear indices corresponding to every distance vector.
+		coordinates reach;                   //!< Maximum absolute value of the distance vectors in every dimension.
+
+		/**
+		 * It computes the cell resulting from adding (or subtracting) a distance vector to a cell dimension by dimension.
+		 * @param cell linear index of the cell.
+		 * @param k index of the distance vector.
+		 * @param sign 1 for adding the distance vector, -1 for subtracting it.
+		 * @param res linear index of the resulting cell. It is only modified if the resulting cell is valid.
+		 * @return true if the resulting cell belongs to the scenario.
+		 */
+		bool shift(std::size_t cell, std::size_t k, int sign, std::size_t& res) const {
+			auto remaining = static_cast<long>(cell);
+			long index = 0;
+			for (std::size_t d = 0; d < shape.size(); ++d) {
+				auto v = remaining % shape[d] + sign * distances[k][d];
+				remaining /= shape[d];
+				if (wrapped) {
+					v = (v % shape[d] + shape[d]) % shape[d];
+				} else if (v < 0 || v >= shape[d]) {
+					return false;
+				}
+				index += v * strides[d];
+			}
+			res = static_cast<std::size_t>(index);
+			return true;
+		}
+	 public:
+		/**
+		 * Constructor function.
+		 * @param scenario grid scenario.
+		 * @param distances distance vectors of the stencil.
+		 * @throw CadmiumModelException if a distance vector is not valid in the scenario.
+		 */
+		GridStencil(const GridScenario& scenario, std::vector<coordinates> distances): shape(scenario.shape),
+		  origin(scenario.origin), wrapped(scenario.wrapped), strides(), distances(std::move(distances)), offsets(), reach(shape.size()) {
+			long stride = 1;
+			for (auto s: shape) {
+				strides.push_back(stride);
+				stride *= s;
+			}
+			for (const auto& distance: this->distances) {
+				if (!scenario.validDistance(distance)) {
+					throw CadmiumModelException("Invalid distance vector");
+				}
+				long offset = 0;
+				for (std::size_t d = 0; d < shape.size(); ++d) {
+					offset += distance[d] * strides[d];
+					reach[d] = std::max(reach[d], std::abs(distance[d]));
+				}
+				offsets.push_back(offset);
+			}
+		}
+
+		//! @return number of distance vectors of the stencil.
+		[[nodiscard]] std::size_t size() const {
+			return distances.size();
+		}
+
+		//! @return number of cells in the scenario.
+		[[nodiscard]] std::size_t nCells() const {
+			return static_cast<std::size_t>(strides.back() * shape.back());
+		}
+
+		/**
+		 * @param d index of a dimension.
+		 * @return maximum absolute value of the distance vectors in the dimension.
+		 */
+		[[nodiscard]] int maxDistance(std::size_t d) const {
+			return reach.at(d);
+		}
+
+		/**
+		 * @param k index of a distance vector.
+		 * @return the corresponding distance vector.
+		 */
+		[[nodiscard]] const coordinates& distance(std::size_t k) const {
+			return distances.at(k);
+		}
+
+		/**
+		 * It computes the linear index of a cell.
+		 * @param cell coordinates of the cell.
+		 * @return linear index of the cell.
+		 * @throw CadmiumModelException if the cell does not belong to the scenario.
+		 */
+		[[nodiscard]] std::size_t cellIndex(const coordinates& cell) const {
+			if (cell.size() != shape.size()) {
+				throw CadmiumModelException("Cell does not belong to scenario");
+			}
+			long index = 0;
+			for (std::size_t d = 0; d < shape.size(); ++d) {
+				auto v = cell[d] - origin[d];
+				if (v < 0 || v >= shape[d]) {
+					throw CadmiumModelException("Cell does not belong to scenario");
+				}
+				index += v * strides[d];
+			}
+			return static_cast<std::size_t>(index);
+		}
+
+		/**
+		 * It computes the coordinates of a cell.
+		 * @param cell linear index of the cell.
+		 * @return coordinates of the cell.
+		 */
+		[[nodiscard]] coordinates cellCoordinates(std::size_t cell) const {
+			coordinates res{};
+			res.reserve(shape.size());
+			auto remaining = static_cast<long>(cell);
+			for (std::size_t d = 0; d < shape.size(); ++d) {
+				res.push_back(static_cast<int>(remaining % shape[d]) + origin[d]);
+				remaining /= shape[d];
+			}
+			return res;
+		}
+
+		/**
+		 * It checks if a cell is an interior cell. All the distance vectors can be added to or subtracted from
+		 * interior cells without leaving (or wrapping around) the scenario. Thus, neighbors of interior cells are unique.
+		 * @param cell linear index of the cell.
+		 * @return true if the cell is an interior cell.
+		 */
+		[[nodiscard]] bool isInterior(std::size_t cell) const {
+			auto remaining = static_cast<long>(cell);
+			for (std::size_t d = 0; d < shape.size(); ++d) {
+				auto v = remaining % shape[d];
+				remaining /= shape[d];
+				if (v < reach[d] || v + reach[d] >= shape[d]) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/**
+		 * It computes the destination cell resulting from adding a distance vector to an origin cell.
+		 * @param cellFrom linear index of the origin cell.
+		 * @param k index of the distance vector.
+		 * @param interior it must be the result of calling isInterior(cellFrom).
+		 * @param res linear index of the destination cell. It is only modified if the destination cell is valid.
+		 * @return true if the destination cell belongs to the scenario.
+		 */
+		bool cellTo(std::size_t cellFrom, std::size_t k, bool interior, std::size_t& res) const {
+			if (interior) {
+				res = static_cast<std::size_t>(static_cast<long>(cellFrom) + offsets[k]);
+				return true;
+			}
+			return shift(cellFrom, k, 1, res);
+		}
+
+		/**
+		 * It computes the origin cell resulting from subtracting a distance vector from a destination cell.
+		 * @param cellTo linear index of the destination cell.
+		 * @param k index of the distance vector.
+		 * @param interior it must be the result of calling isInterior(cellTo).
+		 * @param res linear index of the origin cell. It is only modified if the origin cell is valid.
+		 * @return true if the origin cell belongs to the scenario.
+		 */
+		bool cellFrom(std::size_t cellTo, std::size_t k, bool interior, std::size_t& res) const {
+			if (interior) {
+				res = static_cast<std::size_t>(static_cast<long>(cellTo) - offsets[k]);
+				return true;
+			}
+			return shift(cellTo, k, -1, res);
+		}
+	};
+}  //namespace cadmium::celldevs
+
+#endif //CADMIUM_CELLDEVS_GRID_STENCIL_HPP_
@@ -0,0 +1,447 @@
+/**
+ * Parallel dense simulation engine for grid Cell-DEVS scenarios decomposed in rectangular tiles.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CELLDEVS_GRID_TILED_HPP_
+#define CADMIUM_CELLDEVS_GRID_TILED_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <omp.h>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "dense.hpp"
+#include "utility.hpp"
+#include "../../core/exception.hpp"
+#include "../../core/modeling/time.hpp"
+#include "../../core/simulation/calendar_queue.hpp"
+
+namespace cadmium::celldevs {
+	/**
+	 * @brief Parallel dense simulation engine for grid Cell-DEVS scenarios decomposed in rectangular tiles.
+	 *
+	 * The scenario is partitioned in rectangular tiles, and every tile is simulated by one thread. Each tile keeps the
+	 * published states of its cells in a local array padded with a halo as wide as the neighborhood reach in every
+	 * dimension. Thus, all the neighbors of a cell are found in the local array with a single sum, even in wrapped
+	 * scenarios. Absolute neighbors owned by other tiles get an extra slot at the end of the local array.
+	 * Every simulation step has two phases separated by a barrier. First, the imminent cells of every tile publish
+	 * their state in the local array and write it in the buffers of the tiles that mirror them in their halo.
+	 * Then, every tile reads its buffers, updates its halo, and computes the next state of its receiving cells.
+	 * Every tile schedules its cells in its own calendar queue. Simulations are equivalent to those of the
+	 * DenseGridCellDEVS class (including the order of the logs), but the synchronous mode is never used.
+	 * Thus, scenarios that require it (i.e., "synchronous": true) are rejected.
+	 * @tparam S the type used for representing a cell state.
+	 * @tparam V the type used for representing a neighboring cell's vicinities.
+	 * @tparam T the type used for representing the simulation time. By default, it is double.
+	 */
+	template <typename S, typename V, typename T = double>
+	class TiledGridCellDEVS: public DenseGridCellDEVS<S, V, T> {
+	 private:
+		//! Published state of a cell to be copied to the halo of another tile.
+		struct HaloUpdate {
+			std::size_t slot;  //!< Slot of the cell in the local array of the destination tile.
+			std::size_t cell;  //!< Linear index of the cell in the scenario.
+			S state;           //!< New published state of the cell.
+		};
+
+		//! Rectangular region of the scenario simulated by one thread.
+		struct Tile {
+			coordinates origin;                                          //!< Position of the first cell of the tile in the scenario.
+			coordinates shape;                                           //!< Number of cells of the tile in every dimension.
+			std::vector<long> offsets;                                   //!< Local offset corresponding to every distance vector.
+			std::vector<std::size_t> cells;                              //!< Linear index in the scenario of every slot (or noCell).
+			std::vector<S> published;                                    //!< Latest state published by the cell of every slot.
+			std::unordered_map<std::size_t, std::size_t> mirrors;        //!< Extra slots of absolute neighbors owned by other tiles.
+			CalendarQueue<T> queue{0, T(1), 1};                          //!< Calendar queue with the next output time of every slot.
+			std::vector<std::size_t> imminent;                           //!< Buffer with the cells that publish their state in a step.
+			std::vector<std::size_t> active;                             //!< Buffer with the cells that change in a step.
+			std::vector<std::vector<HaloUpdate>> outbox;                 //!< For every tile, the states to be copied to its halo.
+			std::vector<std::pair<std::size_t, const V*>> neighbors;     //!< Buffer with the neighborhood of a cell.
+			std::vector<std::size_t> neighborCells;                      //!< Buffer with the linear indices of the neighbors.
+		};
+
+		static constexpr std::size_t noCell = std::numeric_limits<std::size_t>::max();  //!< Slots out of the scenario.
+
+		coordinates nTiles;                                //!< Number of tiles in every dimension.
+		std::vector<Tile> tiles;                           //!< Tiles of the scenario.
+		std::vector<std::uint32_t> tileOf;                 //!< Tile of every cell.
+		std::vector<std::size_t> slotOf;                   //!< Slot of every cell in the local array of its tile.
+		std::vector<std::size_t> subscriberStart;          //!< Position of the first mirror of every cell.
+		std::vector<std::pair<std::uint32_t, std::size_t>> subscribers;  //!< Mirrors of the cells as pairs <tile, slot>.
+		std::vector<std::size_t> buffer;                   //!< Buffer with the cells to be logged in a step.
+
+		/**
+		 * It adds a role to a cell of a tile.
+		 * @param tile tile that owns the cell.
+		 * @param cell linear index of the cell.
+		 * @param flag role of the cell in the current step.
+		 */
+		void activate(Tile& tile, std::size_t cell, char flag) {
+			if (this->flags[cell] == 0) {
+				tile.active.push_back(cell);
+			}
+			this->flags[cell] |= flag;
+		}
+
+		/**
+		 * It activates the cells of a tile that have a given cell in their neighborhood.
+		 * @param t index of the tile.
+		 * @param cell linear index of the cell that publishes its state.
+		 */
+		void activateReceivers(std::uint32_t t, std::size_t cell) {
+			auto& tile = tiles[t];
+			auto interior = this->stencil->isInterior(cell);
+			auto nConfigs = this->configs.size();
+			for (std::size_t k = 0; k < this->stencil->size(); ++k) {
+				std::size_t receiver;
+				if (this->stencil->cellFrom(cell, k, interior, receiver) && tileOf[receiver] == t
+				    && this->member[k * nConfigs + this->configIndex[receiver]]) {
+					activate(tile, receiver, this->RECEIVER);
+				}
+			}
+			if (!this->absoluteReceivers.empty()) {
+				auto it = this->absoluteReceivers.find(cell);
+				if (it != this->absoluteReceivers.end()) {
+					for (auto receiver: it->second) {
+						if (tileOf[receiver] == t) {
+							activate(tile, receiver, this->RECEIVER);
+						}
+					}
+				}
+			}
+		}
+
+		/**
+		 * It fills the neighbors buffer of a tile with the neighborhood of one of its cells.
+		 * Neighbors are found in the same order as in DenseGridCellDEVS, so local computations are identical.
+		 * @param tile tile that owns the cell.
+		 * @param cell linear index of the cell.
+		 */
+		void buildNeighborhood(Tile& tile, std::size_t cell) const {
+			const auto& config = this->configs[this->configIndex[cell]];
+			auto slot = static_cast<long>(slotOf[cell]);
+			auto interior = this->stencil->isInterior(cell);
+			tile.neighbors.clear();
+			tile.neighborCells.clear();
+			for (const auto& [k, vicinity]: config.relative) {
+				std::size_t neighbor;
+				if (this->stencil->cellTo(cell, k, interior, neighbor)) {
+					if (interior || std::find(tile.neighborCells.begin(), tile.neighborCells.end(), neighbor) == tile.neighborCells.end()) {
+						tile.neighbors.emplace_back(static_cast<std::size_t>(slot + tile.offsets[k]), &vicinity);
+						tile.neighborCells.push_back(neighbor);
+					}
+				}
+			}
+			for (const auto& [neighbor, vicinity]: config.absolute) {
+				auto it = std::find(tile.neighborCells.begin(), tile.neighborCells.end(), neighbor);
+				if (it == tile.neighborCells.end()) {
+					auto local = (&tiles[tileOf[neighbor]] == &tile) ? slotOf[neighbor] : tile.mirrors.at(neighbor);
+					tile.neighbors.emplace_back(local, &vicinity);
+					tile.neighborCells.push_back(neighbor);
+				} else {
+					tile.neighbors[it - tile.neighborCells.begin()].second = &vicinity;
+				}
+			}
+		}
+
+		//! It partitions the scenario in tiles and builds the local array of every tile.
+		void buildTiles() {
+			const auto& shape = this->scenario->shape;
+			auto nDims = shape.size();
+			if (nTiles.empty()) {
+				nTiles = coordinates(nDims, 1);
+				nTiles.back() = std::min(omp_get_max_threads(), shape.back());
+			}
+			if (nTiles.size() != nDims) {
+				throw CadmiumModelException("invalid number of dimensions");
+			}
+			std::size_t totalTiles = 1;
+			for (std::size_t d = 0; d < nDims; ++d) {
+				if (nTiles[d] < 1 || nTiles[d] > shape[d]) {
+					throw CadmiumModelException("invalid number of tiles");
+				}
+				totalTiles *= nTiles[d];
+			}
+			std::vector<long> strides;
+			long stride = 1;
+			for (auto s: shape) {
+				strides.push_back(stride);
+				stride *= s;
+			}
+			auto nCells = this->stencil->nCells();
+			tileOf = std::vector<std::uint32_t>(nCells);
+			slotOf = std::vector<std::size_t>(nCells);
+			std::vector<std::tuple<std::size_t, std::uint32_t, std::size_t>> mirrors;  // <cell, tile, slot>
+			tiles = std::vector<Tile>(totalTiles);
+			for (std::uint32_t t = 0; t < totalTiles; ++t) {
+				auto& tile = tiles[t];
+				// Every tile covers a rectangular region of the scenario padded with a halo
+				coordinates padded;
+				std::vector<long> localStrides;
+				long localStride = 1;
+				auto remaining = t;
+				for (std::size_t d = 0; d < nDims; ++d) {
+					auto position = static_cast<int>(remaining % nTiles[d]);
+					remaining /= nTiles[d];
+					auto from = static_cast<int>(static_cast<long>(shape[d]) * position / nTiles[d]);
+					auto to = static_cast<int>(static_cast<long>(shape[d]) * (position + 1) / nTiles[d]);
+					tile.origin.push_back(from);
+					tile.shape.push_back(to - from);
+					padded.push_back(to - from + 2 * this->stencil->maxDistance(d));
+					localStrides.push_back(localStride);
+					localStride *= padded.back();
+				}
+				for (std::size_t k = 0; k < this->stencil->size(); ++k) {
+					long offset = 0;
+					for (std::size_t d = 0; d < nDims; ++d) {
+						offset += this->stencil->distance(k)[d] * localStrides[d];
+					}
+					tile.offsets.push_back(offset);
+				}
+				tile.cells = std::vector<std::size_t>(localStride, noCell);
+				for (long slot = 0; slot < localStride; ++slot) {
+					auto local = slot;
+					long cell = 0;
+					bool valid = true;
+					bool owned = true;
+					for (std::size_t d = 0; d < nDims && valid; ++d) {
+						auto v = static_cast<int>(local % padded[d]) - this->stencil->maxDistance(d);
+						local /= padded[d];
+						owned = owned && v >= 0 && v < tile.shape[d];
+						v += tile.origin[d];
+						if (this->scenario->wrapped) {
+							v = (v % shape[d] + shape[d]) % shape[d];
+						} else if (v < 0 || v >= shape[d]) {
+							valid = false;
+						}
+						cell += v * strides[d];
+					}
+					if (valid) {
+						tile.cells[slot] = static_cast<std::size_t>(cell);
+						if (owned) {
+							tileOf[cell] = t;
+							slotOf[cell] = static_cast<std::size_t>(slot);
+						} else {
+							mirrors.emplace_back(static_cast<std::size_t>(cell), t, static_cast<std::size_t>(slot));
+						}
+					}
+				}
+			}
+			// Absolute neighbors owned by other tiles are mirrored in extra slots
+			for (const auto& [neighbor, receivers]: this->absoluteReceivers) {
+				for (auto receiver: receivers) {
+					auto t = tileOf[receiver];
+					auto& tile = tiles[t];
+					if (tileOf[neighbor] != t && tile.mirrors.find(neighbor) == tile.mirrors.end()) {
+						tile.mirrors[neighbor] = tile.cells.size();
+						mirrors.emplace_back(neighbor, t, tile.cells.size());
+						tile.cells.push_back(neighbor);
+					}
+				}
+			}
+			std::sort(mirrors.begin(), mirrors.end());
+			subscriberStart = std::vector<std::size_t>(nCells + 1);
+			subscribers.clear();
+			for (const auto& [cell, t, slot]: mirrors) {
+				subscriberStart[cell + 1]++;
+				subscribers.emplace_back(t, slot);
+			}
+			for (std::size_t cell = 0; cell < nCells; ++cell) {
+				subscriberStart[cell + 1] += subscriberStart[cell];
+			}
+			// As regular cells, all the cells output their initial state at the beginning of the simulation
+			for (auto& tile: tiles) {
+				tile.published.reserve(tile.cells.size());
+				tile.queue = CalendarQueue<T>(tile.cells.size(), this->width, 1);
+				for (std::size_t slot = 0; slot < tile.cells.size(); ++slot) {
+					auto cell = tile.cells[slot];
+					tile.published.push_back((cell == noCell) ? S() : this->states[cell]);
+					if (cell != noCell && &tiles[tileOf[cell]] == &tile && slotOf[cell] == slot) {
+						tile.queue.schedule(slot, this->timeLast);
+					}
+				}
+				tile.outbox.resize(tiles.size());
+			}
+			// The global arrays and queue of the dense engine are not used
+			this->published = std::vector<S>();
+			this->imminent = std::vector<std::size_t>();
+			this->queue = CalendarQueue<T>(0, this->width, 1);
+		}
+
+		/**
+		 * Imminent cells of a tile publish their pending state in the local array and in the outbox of the tile.
+		 * With active frontiers, cells do not publish their pending state if it is equal to their published state.
+		 * @param t index of the tile.
+		 * @param time current simulation time.
+		 */
+		void publishImminent(std::uint32_t t, T time) {
+			auto& tile = tiles[t];
+			tile.imminent.clear();
+			tile.active.clear();
+			if (tile.queue.nextTime() != time) {
+				return;
+			}
+			tile.queue.pop(tile.imminent);
+			for (auto& slot: tile.imminent) {
+				slot = tile.cells[slot];
+			}
+			std::sort(tile.imminent.begin(), tile.imminent.end());
+			std::size_t nPublished = 0;
+			for (auto cell: tile.imminent) {
+				activate(tile, cell, this->IMMINENT);
+				const auto& state = this->pending[cell];
+				auto& published = tile.published[slotOf[cell]];
+				if (this->initialStep || !this->configs[this->configIndex[cell]].config->activeFrontier || state != published) {
+					published = state;
+					tile.imminent[nPublished++] = cell;  // imminent cells that actually publish are moved to the front
+					for (auto i = subscriberStart[cell]; i < subscriberStart[cell + 1]; ++i) {
+						const auto& [to, slot] = subscribers[i];
+						tile.outbox[to].push_back({slot, cell, state});
+					}
+				}
+			}
+			tile.imminent.resize(nPublished);
+		}
+
+		/**
+		 * A tile reads the outboxes addressed to it, updates its halo, and computes the next state of its receivers.
+		 * @param t index of the tile.
+		 * @param time current simulation time.
+		 */
+		void transition(std::uint32_t t, T time) {
+			auto& tile = tiles[t];
+			for (auto cell: tile.imminent) {
+				activateReceivers(t, cell);
+			}
+			for (auto& from: tiles) {
+				for (const auto& update: from.outbox[t]) {
+					tile.published[update.slot] = update.state;
+					activateReceivers(t, update.cell);
+				}
+				from.outbox[t].clear();
+			}
+			std::sort(tile.active.begin(), tile.active.end());
+			for (auto cell: tile.active) {
+				if (this->flags[cell] & this->RECEIVER) {
+					buildNeighborhood(tile, cell);
+					const auto& rule = *this->configs[this->configIndex[cell]].rule;
+					auto nextState = rule.localComputation(this->states[cell], DenseNeighborhood<S, V>(tile.published, tile.neighbors));
+					if (nextState != this->states[cell]) {
+						tile.queue.schedule(slotOf[cell], time + rule.outputDelay(nextState));
+						this->pending[cell] = nextState;
+					}
+					this->states[cell] = std::move(nextState);
+				}
+				this->flags[cell] = 0;
+			}
+		}
+
+		/**
+		 * It gathers the cells of all the tiles in the logging buffer, sorted by their linear index.
+		 * @param list pointer to the member of the tiles with the cells to be gathered.
+		 */
+		void gather(std::vector<std::size_t> Tile::* list) {
+			buffer.clear();
+			for (const auto& tile: tiles) {
+				buffer.insert(buffer.end(), (tile.*list).begin(), (tile.*list).end());
+			}
+			std::sort(buffer.begin(), buffer.end());
+		}
+
+		//! @return time of the next simulation step.
+		[[nodiscard]] T nextTime() override {
+			auto timeNext = TimeTraits<T>::infinity();
+			for (auto& tile: tiles) {
+				timeNext = std::min(timeNext, tile.queue.nextTime());
+			}
+			return timeNext;
+		}
+
+		/**
+		 * It runs a simulation step. Tiles are simulated in parallel.
+		 * @param time simulation time of the step. It must be the result of nextTime().
+		 */
+		void simulationAdvance(T time) override {
+			auto nTotal = static_cast<long>(tiles.size());
+			// Output: imminent cells publish their pending state (there is an implicit barrier after the loop)
+			#pragma omp parallel for schedule(static)
+			for (long t = 0; t < nTotal; ++t) {
+				publishImminent(static_cast<std::uint32_t>(t), time);
+			}
+			this->initialStep = false;
+			if (this->logger != nullptr) {
+				this->logger->logTime(TimeTraits<T>::toDouble(time));
+				gather(&Tile::imminent);
+				for (auto cell: buffer) {
+					std::stringstream ss;
+					ss << this->pending[cell];
+					this->logger->logOutput(TimeTraits<T>::toDouble(time), static_cast<long>(cell), this->cellId(cell), "outputNeighborhood", ss.str());
+				}
+			}
+			// Transition: tiles update their halo and compute the next state of their receivers
+			std::exception_ptr error;
+			#pragma omp parallel for schedule(static)
+			for (long t = 0; t < nTotal; ++t) {
+				try {
+					transition(static_cast<std::uint32_t>(t), time);
+				} catch (...) {
+					#pragma omp critical
+					error = std::current_exception();
+				}
+			}
+			if (error) {
+				std::rethrow_exception(error);
+			}
+			if (this->logger != nullptr) {
+				gather(&Tile::active);
+				for (auto cell: buffer) {
+					this->logState(time, cell);
+				}
+			}
+			this->timeLast = time;
+		}
+	 public:
+		/**
+		 * Constructor function. It reads the configuration file, but it does not build the scenario.
+		 * @param id ID of the grid Cell-DEVS scenario.
+		 * @param factory pointer to the rule factory function. It is called once per cell configuration.
+		 * @param configFilePath path to the scenario configuration file.
+		 * @param nTiles number of tiles in every dimension. By default, the last dimension is split in one tile per thread.
+		 * @param width width of the buckets of the calendar queues. It should be similar to the usual output delay.
+		 */
+		TiledGridCellDEVS(std::string id, denseGridRuleFactory<S, V, T> factory, const std::string& configFilePath,
+		  coordinates nTiles = {}, T width = T(1)): DenseGridCellDEVS<S, V, T>(std::move(id), factory, configFilePath, width),
+		  nTiles(std::move(nTiles)), tiles(), tileOf(), slotOf(), subscriberStart(), subscribers(), buffer() {}
+
+		/**
+		 * It builds the grid Cell-DEVS scenario and partitions it in tiles.
+		 * @throw CadmiumModelException if the scenario requires the synchronous mode or the number of tiles is not valid.
+		 */
+		void buildModel() override {
+			const auto& rawScenario = this->rawConfig.at("scenario");
+			if (rawScenario.contains("synchronous") && rawScenario["synchronous"].template get<bool>()) {
+				throw CadmiumModelException("tiled scenarios do not support synchronous simulation");
+			}
+			DenseGridCellDEVS<S, V, T>::buildModel();
+			this->synchronous = false;
+			buildTiles();
+		}
+
+		//! @return number of tiles in every dimension.
+		[[nodiscard]] const coordinates& getTiles() const {
+			return nTiles;
+		}
+	};
+}  //namespace cadmium::celldevs
+
+#endif //CADMIUM_CELLDEVS_GRID_TILED_HPP_
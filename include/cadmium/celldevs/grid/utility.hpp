@@ -1,5 +1,5 @@
 /**
- * Utility stuff for vectors. These are required for grid-based Cell-DEVS scenarios.
+ * Utility stuff for vectors and arrays. These are required for grid-based Cell-DEVS scenarios.
  * SPDX-License-Identifier: MIT
  * Copyright (c) 2022-present Román Cárdenas Rodríguez
  * ARSLab - Carleton University
@@ -10,14 +10,43 @@
 #ifndef CADMIUM_CELLDEVS_GRID_UTILILITY_HPP_
 #define CADMIUM_CELLDEVS_GRID_UTILILITY_HPP_
 
+#include <array>
 #include <cstddef>
 #include <iostream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace cadmium::celldevs {
 	using coordinates = std::vector<int>;  //!< Type alias for referring to cell coordinates
 
+	/**
+	 * Type alias for referring to cell coordinates in scenarios with a fixed number of dimensions.
+	 * If N is greater than 0, coordinates are arrays of N integers (i.e., they do not allocate memory in the heap).
+	 * If N is 0, the number of dimensions is only known at runtime, and coordinates are vectors of integers.
+	 * @tparam N number of dimensions of the scenario.
+	 */
+	template <std::size_t N>
+	using gridCoordinates = std::conditional_t<N == 0, coordinates, std::array<int, N>>;
+
+	/**
+	 * It creates cell coordinates with the same value in all their dimensions.
+	 * @tparam N number of dimensions of the scenario (0 if it is only known at runtime).
+	 * @param nDims number of dimensions. It is only used when N is 0.
+	 * @param value value of the coordinates in every dimension.
+	 * @return the resulting coordinates.
+	 */
+	template <std::size_t N>
+	gridCoordinates<N> filledCoordinates(std::size_t nDims, int value) {
+		if constexpr (N == 0) {
+			return coordinates(nDims, value);
+		} else {
+			gridCoordinates<N> res{};
+			res.fill(value);
+			return res;
+		}
+	}
+
 	/**
 	 * Auxiliary function for printing cell coordinates.
 	 * @param os output stream.
@@ -34,6 +63,24 @@ namespace cadmium::celldevs {
 		os << ")";
 		return os;
 	}
+
+	/**
+	 * Auxiliary function for printing cell coordinates of scenarios with a fixed number of dimensions.
+	 * @param os output stream.
+	 * @param v coordinates to be printed.
+	 * @return output stream containing the printed values of the coordinates.
+	*/
+	template <std::size_t N>
+	std::ostream &operator<<(std::ostream &os, const std::array<int, N> & v) {
+		os << "(";
+		std::string separator;
+		for (const auto &x : v) {
+			os << separator << x;
+			separator = ",";
+		}
+		os << ")";
+		return os;
+	}
 }  //namespace cadmium::celldevs
 
 /**
@@ -59,4 +106,27 @@ struct std::hash<std::vector<T>> {
 	}
 };
 
+/**
+ * @brief Auxiliary hash container for arrays.
+ *
+ * It allows us to use arrays as keys in hash maps.
+ * @tparam T array content type.
+ * @tparam N array size.
+ */
+template <typename T, std::size_t N>
+struct std::hash<std::array<T, N>> {
+	/**
+	 * Hashing function for arrays. It follows the same approach as the hashing function for vectors.
+	 * @param arr array to be used by the hashing function.
+	 * @return hash resulting from the array.
+	 */
+	std::size_t operator()(const std::array<T, N>& arr) const {
+		std::size_t seed = N;
+		for(const auto &i: arr) {
+			seed ^= hash<T>()(i) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		}
+		return seed;
+	}
+};
+
 #endif //CADMIUM_CELLDEVS_GRID_UTILILITY_HPP_
@@ -10,13 +10,17 @@
 #ifndef CADMIUM_CORE_MODELING_ATOMIC_HPP_
 #define CADMIUM_CORE_MODELING_ATOMIC_HPP_
 
+#include <any>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include "component.hpp"
 #include "port.hpp"
+#include "time.hpp"
+#include "../exception.hpp"
 
 namespace cadmium {
 	/**
@@ -24,14 +28,16 @@ namespace cadmium {
 	 *
 	 * This abstract class does not consider atomic models' state,
 	 * so Cadmium can treat atomic models with different state types as if they were of the same class.
+	 * @tparam T the data type used for representing the simulation time.
 	 */
-    class AtomicInterface: public Component {
+	template <typename T>
+    class BasicAtomicInterface: public Component {
      public:
 		/**
 		 * Constructor function.
 		 * @param id ID of the atomic model.
 		 */
-        explicit AtomicInterface(const std::string& id): Component(id) {}
+        explicit BasicAtomicInterface(const std::string& id): Component(id) {}
 
 		//! Virtual method for the atomic model's internal transition function.
         virtual void internalTransition() = 0;
@@ -40,16 +46,16 @@ namespace cadmium {
 		 * Virtual method for the atomic model's external transition function.
 		 * @param e time elapsed since the last state transition of the model.
 		 */
-        virtual void externalTransition(double e) = 0;
+        virtual void externalTransition(T e) = 0;
 
 		/**
 		 * Virtual method for the atomic model's confluent transition function.
 		 * By default, it first triggers the internal transition function and then the external with e = 0.
 		 * @param e time elapsed since the last state transition of the model.
 		 */
-        virtual void confluentTransition(double e) {
+        virtual void confluentTransition(T e) {
 			this->internalTransition();
-			this->externalTransition(0.);
+			this->externalTransition(TimeTraits<T>::zero());
 		}
 
 		//! Virtual method for the atomic model's output function.
@@ -59,23 +65,63 @@ namespace cadmium {
 		 * Virtual method for the atomic model's time advance function.
 		 * @return time to wait until next internal transition.
 		 */
-        [[nodiscard]] virtual double timeAdvance() const = 0;
+        [[nodiscard]] virtual T timeAdvance() const = 0;
 
 		/**
 		 * Virtual method to log the atomic model's current state.
 		 * @return string representing the current state of the atomic model.
 		 */
 		[[nodiscard]] virtual std::string logState() const = 0;
+
+		/**
+		 * Virtual method for the lookahead of the atomic model. Conservative parallel simulators rely on it.
+		 * After an external transition at time t, the model MUST NOT schedule its next internal transition before
+		 * t + lookahead, unless the next internal transition was already scheduled before the external transition.
+		 * By default, it returns 0 (i.e., no lookahead).
+		 * @return minimum time between receiving a message and outputting a new message as a response to it.
+		 */
+		[[nodiscard]] virtual T lookahead() const {
+			return TimeTraits<T>::zero();
+		}
+
+		/**
+		 * Virtual method to save a copy of the atomic model's current state. Optimistic simulators need it for rolling back.
+		 * By default, it throws an exception, as the state of the model is unknown.
+		 * @return copy of the current state of the atomic model.
+		 */
+		[[nodiscard]] virtual std::any saveState() const {
+			throw CadmiumModelException("atomic model does not support state saving");
+		}
+
+		/**
+		 * Virtual method to restore a state previously saved with the saveState method.
+		 * Its argument is the copy of the state returned by saveState.
+		 * By default, it throws an exception, as the state of the model is unknown.
+		 */
+		virtual void restoreState(const std::any&) {
+			throw CadmiumModelException("atomic model does not support state restoring");
+		}
+
+		/**
+		 * Virtual method to re-allocate the dynamic memory of the atomic model's state from the calling thread.
+		 * On NUMA systems, memory pages are usually placed on the node of the thread that touches them first.
+		 * Parallel simulators call this method from the thread that will execute the model. By default, it does nothing.
+		 */
+		virtual void relocateState() {}
     };
 
+	//! Interface for DEVS atomic models that represent the simulation time with doubles.
+	using AtomicInterface = BasicAtomicInterface<double>;
+
 	/**
 	 * @brief DEVS atomic model.
 	 *
 	 * The Atomic class is closer to the DEVS formalism than the AtomicInterface class.
 	 * @tparam S the data type used for representing a cell state.
+	 * @tparam T the data type used for representing the simulation time. By default, it is double.
 	 */
-    template <typename S>
-    class Atomic: public AtomicInterface {
+    template <typename S, typename T = double>
+    class Atomic: public BasicAtomicInterface<T> {
      protected:
         S state;  //! Atomic model state.
      public:
@@ -84,7 +130,7 @@ namespace cadmium {
 		 * @param id ID of the atomic model.
 		 * @param initialState initial atomic model state.
 		 */
-        explicit Atomic(const std::string& id, S initialState) : AtomicInterface(id), state(std::move(initialState)) {}
+        explicit Atomic(const std::string& id, S initialState) : BasicAtomicInterface<T>(id), state(std::move(initialState)) {}
 
 		/**
 		 * Virtual method for the atomic model internal transition function.
@@ -98,7 +144,7 @@ namespace cadmium {
 		 * @param e time elapsed since the last state transition function was triggered.
 		 * @param x reference to the atomic model input port set. You can READ input messages here.
 		 */
-        virtual void externalTransition(S& s, double e) const = 0;
+        virtual void externalTransition(S& s, T e) const = 0;
 
 		/**
 		 * Virtual method for the atomic model output function.
@@ -112,7 +158,7 @@ namespace cadmium {
 		 * @param s reference to the current atomic model state. You can READ the atomic model state here.
 		 * @return time to wait for the next internal transition function.
 		 */
-        virtual double timeAdvance(const S& s) const = 0;
+        virtual T timeAdvance(const S& s) const = 0;
 
 		/**
 		 * Virtual method for the confluent transition function.
@@ -120,20 +166,20 @@ namespace cadmium {
 		 * @param e time elapsed since the last state transition function was triggered.
 		 * @param x reference to the atomic model input port set. You can READ input messages here.
 		 */
-        virtual void confluentTransition(S& s, double e) const {
+        virtual void confluentTransition(S& s, T e) const {
             this->internalTransition(s);
-            this->externalTransition(s, 0.);
+            this->externalTransition(s, TimeTraits<T>::zero());
         }
 
         void internalTransition() override {
             this->internalTransition(state);
         }
 
-        void externalTransition(double e) override {
+        void externalTransition(T e) override {
             this->externalTransition(state, e);
         }
 
-        void confluentTransition(double e) override {
+        void confluentTransition(T e) override {
             this->confluentTransition(state, e);
         }
 
@@ -141,7 +187,7 @@ namespace cadmium {
             this->output(state);
         }
 
-        [[nodiscard]] double timeAdvance() const override {
+        [[nodiscard]] T timeAdvance() const override {
             return this->timeAdvance(state);
         }
 
@@ -151,6 +197,34 @@ namespace cadmium {
 			ss << state;
 			return ss.str();
 		}
+
+		//! @return a copy of the model state. S must be copy constructible.
+		[[nodiscard]] std::any saveState() const override {
+			if constexpr (std::is_copy_constructible_v<S>) {
+				return state;
+			} else {
+				return BasicAtomicInterface<T>::saveState();
+			}
+		}
+
+		/**
+		 * It restores a model state previously saved with the saveState method. S must be copy assignable.
+		 * @param savedState copy of the state of the atomic model.
+		 */
+		void restoreState(const std::any& savedState) override {
+			if constexpr (std::is_copy_constructible_v<S> && std::is_copy_assignable_v<S>) {
+				state = std::any_cast<const S&>(savedState);
+			} else {
+				BasicAtomicInterface<T>::restoreState(savedState);
+			}
+		}
+
+		//! It replaces the model state with a copy created by the calling thread. S must be copy constructible.
+		void relocateState() override {
+			if constexpr (std::is_copy_constructible_v<S> && std::is_move_assignable_v<S>) {
+				state = S(static_cast<const S&>(state));
+			}
+		}
     };
 }
 
@@ -10,6 +10,7 @@
 #ifndef CADMIUM_CORE_MODELING_COUPLED_HPP_
 #define CADMIUM_CORE_MODELING_COUPLED_HPP_
 
+#include <algorithm>
 #include <memory>
 #include <cstring>
 #include <string>
@@ -34,6 +35,7 @@ namespace cadmium {
     class Coupled: public Component {
      protected:
         std::unordered_map<std::string, std::shared_ptr<Component>> components;  //!< Components set.
+        std::vector<std::shared_ptr<Component>> componentOrder;                  //!< Components in simulation order.
         MappedCouplings EIC;  //!< External Input Coupling set.
         MappedCouplings IC;   //!< Internal Coupling set.
         MappedCouplings EOC;  //!< External Output Coupling set.
@@ -56,18 +58,33 @@ namespace cadmium {
             serialEOC.emplace_back(portFrom, portTo);
         }
 
+        /**
+         * It sorts the subcomponents. Coordinators create the simulators of the subcomponents in this order.
+         * @tparam F type of the comparison function.
+         * @param compare function that returns true if its first component must be simulated before the second one.
+         */
+        template <typename F>
+        void sortComponents(F compare) {
+            std::stable_sort(componentOrder.begin(), componentOrder.end(), compare);
+        }
+
      public:
         /**
          * Constructor function.
          * @param id ID of the coupled model.
          */
-        explicit Coupled(const std::string& id): Component(id), components(), EIC(), IC(), EOC() {}
+        explicit Coupled(const std::string& id): Component(id), components(), componentOrder(), EIC(), IC(), EOC() {}
 
         //! @return reference to the component set.
         std::unordered_map<std::string, std::shared_ptr<Component>>& getComponents() {
             return components;
         }
 
+        //! @return reference to the subcomponents in simulation order (by default, the order in which they were added).
+        [[nodiscard]] const std::vector<std::shared_ptr<Component>>& getOrderedComponents() const {
+            return componentOrder;
+        }
+
         //! @return reference to the EIC set.
         const MappedCouplings& getEICs() {
             return EIC;
@@ -123,6 +140,7 @@ namespace cadmium {
             }
             component->setParent(this);
             components[component->getId()] = component;
+            componentOrder.push_back(component);
         }
 
         /**
@@ -315,8 +333,8 @@ namespace cadmium {
         void flatten(Coupled * parentPointer) {
             // First, we identify the coupled subcomponents that need to be flattened
             std::vector<std::shared_ptr<Coupled>> toFlatten;
-            for (auto& component: components) {
-                auto coupled = std::dynamic_pointer_cast<Coupled>(component.second);
+            for (auto& component: componentOrder) {
+                auto coupled = std::dynamic_pointer_cast<Coupled>(component);
                 if (coupled != nullptr) {
                     toFlatten.push_back(coupled);
                 }
@@ -327,6 +345,9 @@ namespace cadmium {
                 removeFlattenedCouplings(coupled);
                 components.erase(coupled->getId());
             }
+            componentOrder.erase(std::remove_if(componentOrder.begin(), componentOrder.end(), [](const auto& component) {
+                return std::dynamic_pointer_cast<Coupled>(component) != nullptr;
+            }), componentOrder.end());
             // Finally, we deserialize the resulting couplings. The model is already flat!
             EIC = deserializeCouplings(serialEIC);
             IC = deserializeCouplings(serialIC);
@@ -335,7 +356,7 @@ namespace cadmium {
             // If pointer to parent is not null, we propagate the flattening to the corresponding parent coupled model.
             if(parentPointer != nullptr) {
                 // We add pass the components to the parent coupled model
-                for (auto& [componentId, component]: components) {
+                for (auto& component: componentOrder) {
                     parentPointer->addComponent(component);
                 }
                 // We adapt EIC couplings and add to the parent coupled model
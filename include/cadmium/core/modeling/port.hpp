@@ -18,6 +18,7 @@
 #include <typeinfo>
 #include <vector>
 #include "component.hpp"
+#include "serialization.hpp"
 #include "../exception.hpp"
 
 namespace cadmium {
@@ -92,6 +93,21 @@ namespace cadmium {
          * @return a string representation of the ith message in the port bag.
          */
         [[nodiscard]] virtual std::string logMessage(std::size_t i) const = 0;  // TODO change to lazy iterator
+
+        /**
+         * It appends a binary representation of all the messages in the port bag to a buffer.
+         * @param buffer destination buffer.
+         * @throw CadmiumModelException if the messages of the port are not serializable.
+         */
+        virtual void serialize(std::vector<char>& buffer) const = 0;
+
+        /**
+         * It reads messages serialized by a compatible port and adds them to the port bag.
+         * @param cursor reference to the current position in the buffer. It is moved to the end of the messages.
+         * @param end end of the buffer.
+         * @throw CadmiumModelException if the messages of the port are not serializable or the buffer is truncated.
+         */
+        virtual void deserialize(const char*& cursor, const char* end) = 0;
     };
 
     /**
@@ -182,6 +198,29 @@ namespace cadmium {
             ss << bag.at(i);
             return ss.str();
         }
+
+        /**
+         * It appends a binary representation of all the messages in the port bag to a buffer.
+         * The number of messages goes first. Messages are serialized with the Serializer<T> struct.
+         * @param buffer destination buffer.
+         * @throw CadmiumModelException if the messages of the port are not serializable.
+         */
+        void serialize(std::vector<char>& buffer) const override {
+            Serializer<std::vector<T>>::write(buffer, bag);
+        }
+
+        /**
+         * It reads messages serialized by a compatible port and adds them to the port bag.
+         * @param cursor reference to the current position in the buffer. It is moved to the end of the messages.
+         * @param end end of the buffer.
+         * @throw CadmiumModelException if the messages of the port are not serializable or the buffer is truncated.
+         */
+        void deserialize(const char*& cursor, const char* end) override {
+            auto size = Serializer<std::uint64_t>::read(cursor, end);
+            for (std::uint64_t i = 0; i < size; ++i) {
+                bag.push_back(Serializer<T>::read(cursor, end));
+            }
+        }
     };
 
     //! Type alias to work with shared pointers pointing to _Port<T> objects with less boilerplate code.
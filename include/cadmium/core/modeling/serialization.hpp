@@ -0,0 +1,148 @@
+/**
+ * Binary serialization of port messages for distributed simulation.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_MODELING_SERIALIZATION_HPP_
+#define CADMIUM_CORE_MODELING_SERIALIZATION_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "../exception.hpp"
+
+namespace cadmium {
+    /**
+     * It reads raw bytes from a buffer and moves the cursor forward.
+     * @param cursor reference to the current position in the buffer.
+     * @param end end of the buffer.
+     * @param dst destination of the bytes.
+     * @param n number of bytes to be read.
+     * @throw CadmiumModelException if the buffer does not contain enough bytes.
+     */
+    inline void readBytes(const char*& cursor, const char* end, void* dst, std::size_t n) {
+        if (static_cast<std::size_t>(end - cursor) < n) {
+            throw CadmiumModelException("serialized message is truncated");
+        }
+        std::memcpy(dst, cursor, n);
+        cursor += n;
+    }
+
+    /**
+     * It appends raw bytes to a buffer.
+     * @param buffer destination buffer.
+     * @param src source of the bytes.
+     * @param n number of bytes to be written.
+     */
+    inline void writeBytes(std::vector<char>& buffer, const void* src, std::size_t n) {
+        auto begin = static_cast<const char*>(src);
+        buffer.insert(buffer.end(), begin, begin + n);
+    }
+
+    /**
+     * @brief Binary serializer of messages.
+     *
+     * Ports use serializers to send messages to other processes in distributed simulations.
+     * Trivially copyable types, strings, vectors, and shared pointers to constant messages are supported out of the box.
+     * Modelers can add support for other message types by specializing this struct in the cadmium namespace.
+     * By default, messages cannot be serialized.
+     * @tparam T data type of the message.
+     */
+    template <typename T, typename = void>
+    struct Serializer {
+        static void write(std::vector<char>&, const T&) {
+            throw CadmiumModelException("message type is not serializable");
+        }
+
+        static T read(const char*&, const char*) {
+            throw CadmiumModelException("message type is not serializable");
+        }
+    };
+
+    /**
+     * Serializer of trivially copyable messages. Messages are copied byte by byte.
+     * Raw pointers are excluded, as addresses are meaningless in other processes.
+     */
+    template <typename T>
+    struct Serializer<T, std::enable_if_t<std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>>> {
+        static void write(std::vector<char>& buffer, const T& message) {
+            writeBytes(buffer, &message, sizeof(T));
+        }
+
+        static T read(const char*& cursor, const char* end) {
+            std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+            readBytes(cursor, end, &storage, sizeof(T));
+            return *reinterpret_cast<T*>(&storage);
+        }
+    };
+
+    //! Serializer of strings. The length of the string goes before its characters.
+    template <>
+    struct Serializer<std::string> {
+        static void write(std::vector<char>& buffer, const std::string& message) {
+            Serializer<std::uint64_t>::write(buffer, message.size());
+            writeBytes(buffer, message.data(), message.size());
+        }
+
+        static std::string read(const char*& cursor, const char* end) {
+            std::string message(Serializer<std::uint64_t>::read(cursor, end), '\0');
+            readBytes(cursor, end, message.data(), message.size());
+            return message;
+        }
+    };
+
+    //! Serializer of vectors. The length of the vector goes before its elements.
+    template <typename T>
+    struct Serializer<std::vector<T>> {
+        //! Vectors of trivially copyable elements are copied in one go (except std::vector<bool>, which is packed).
+        static constexpr bool bulk = std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>;
+
+        static void write(std::vector<char>& buffer, const std::vector<T>& message) {
+            Serializer<std::uint64_t>::write(buffer, message.size());
+            if constexpr (bulk) {
+                writeBytes(buffer, message.data(), message.size() * sizeof(T));
+            } else {
+                for (const auto& elem: message) {
+                    Serializer<T>::write(buffer, elem);
+                }
+            }
+        }
+
+        static std::vector<T> read(const char*& cursor, const char* end) {
+            auto size = Serializer<std::uint64_t>::read(cursor, end);
+            std::vector<T> message;
+            if constexpr (bulk && std::is_default_constructible_v<T>) {
+                message.resize(size);
+                readBytes(cursor, end, message.data(), size * sizeof(T));
+                return message;
+            }
+            message.reserve(size);
+            for (std::uint64_t i = 0; i < size; ++i) {
+                message.push_back(Serializer<T>::read(cursor, end));
+            }
+            return message;
+        }
+    };
+
+    //! Serializer of shared pointers to constant messages (e.g., messages of big ports). It serializes the pointed message.
+    template <typename T>
+    struct Serializer<std::shared_ptr<const T>> {
+        static void write(std::vector<char>& buffer, const std::shared_ptr<const T>& message) {
+            if (message == nullptr) {
+                throw CadmiumModelException("null messages are not serializable");
+            }
+            Serializer<T>::write(buffer, *message);
+        }
+
+        static std::shared_ptr<const T> read(const char*& cursor, const char* end) {
+            return std::make_shared<const T>(Serializer<T>::read(cursor, end));
+        }
+    };
+}
+
+#endif //CADMIUM_CORE_MODELING_SERIALIZATION_HPP_
@@ -0,0 +1,199 @@
+/**
+ * Data types and traits for representing the simulation time.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_MODELING_TIME_HPP_
+#define CADMIUM_CORE_MODELING_TIME_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+namespace cadmium {
+	/**
+	 * @brief Traits of the data types used for representing the simulation time.
+	 *
+	 * By default, Cadmium uses doubles. Any floating-point type is supported. For integer times, use the Ticks type
+	 * (root coordinators use integers for counting simulation steps). Other types must specialize this struct.
+	 * @tparam T data type used for representing the simulation time.
+	 */
+	template <typename T>
+	struct TimeTraits {
+		static_assert(std::is_floating_point_v<T>, "non-floating-point time types must specialize the TimeTraits struct");
+
+		//! @return the zero time.
+		static constexpr T zero() {
+			return T();
+		}
+
+		//! @return the infinity time.
+		static constexpr T infinity() {
+			return std::numeric_limits<T>::infinity();
+		}
+
+		/**
+		 * It converts a time to a double. Loggers and other utilities work with doubles.
+		 * @param t time to be converted.
+		 * @return t as a double.
+		 */
+		static constexpr double toDouble(T t) {
+			return static_cast<double>(t);
+		}
+
+		/**
+		 * It returns the index of the bucket that contains a given time. Calendar queues rely on it.
+		 * @param t time. It must not be infinity.
+		 * @param width width of the buckets. It must be greater than zero.
+		 * @return index of the bucket that contains t (i.e., floor(t / width)).
+		 */
+		static std::int64_t bucket(T t, T width) {
+			return static_cast<std::int64_t>(std::floor(t / width));
+		}
+	};
+
+	/**
+	 * @brief Fixed-point representation of the simulation time.
+	 *
+	 * Times are stored as an integer number of ticks, and each tick lasts 1 / Scale time units.
+	 * For instance, FixedPoint<1000> represents times with a resolution of one millisecond if the time unit is
+	 * the second. Sums and subtractions of fixed-point times are exact, so simultaneous events remain simultaneous
+	 * no matter how many times models accumulate the elapsed time. Operations with infinity saturate to infinity.
+	 * @tparam Scale number of ticks per time unit. It must be greater than zero.
+	 */
+	template <std::int64_t Scale>
+	class FixedPoint {
+		static_assert(Scale > 0, "fixed-point scale must be greater than zero");
+	 private:
+		static constexpr std::int64_t INF = std::numeric_limits<std::int64_t>::max();  //!< Ticks of infinity.
+		std::int64_t ticks;  //!< Number of ticks.
+
+		//! Tag for building fixed-point times from a number of ticks.
+		struct TicksTag {};
+		constexpr FixedPoint(std::int64_t ticks, TicksTag): ticks(ticks) {}
+	 public:
+		//! Default constructor function. It represents time zero.
+		constexpr FixedPoint(): ticks() {}
+
+		/**
+		 * Constructor function. Values are rounded to the nearest tick. Non-finite values are mapped to infinity.
+		 * @tparam N arithmetic type of the value.
+		 * @param value time in time units.
+		 */
+		template <typename N, std::enable_if_t<std::is_arithmetic_v<N>, bool> = true>
+		constexpr FixedPoint(N value): ticks() {
+			if constexpr (std::is_floating_point_v<N>) {
+				ticks = (std::isfinite(value)) ? std::llround(value * (double) Scale) : INF;
+			} else {
+				ticks = static_cast<std::int64_t>(value) * Scale;
+			}
+		}
+
+		/**
+		 * It creates a fixed-point time from a number of ticks.
+		 * @param ticks number of ticks.
+		 * @return the corresponding fixed-point time.
+		 */
+		static constexpr FixedPoint fromTicks(std::int64_t ticks) {
+			return {ticks, TicksTag()};
+		}
+
+		//! @return the infinity time.
+		static constexpr FixedPoint infinity() {
+			return fromTicks(INF);
+		}
+
+		//! @return number of ticks of the time.
+		[[nodiscard]] constexpr std::int64_t getTicks() const {
+			return ticks;
+		}
+
+		//! @return true if the time is infinity.
+		[[nodiscard]] constexpr bool isInfinity() const {
+			return ticks == INF;
+		}
+
+		//! @return the time as a double.
+		[[nodiscard]] constexpr double toDouble() const {
+			return (isInfinity()) ? std::numeric_limits<double>::infinity() : (double) ticks / (double) Scale;
+		}
+
+		FixedPoint& operator+=(FixedPoint other) {
+			ticks = (isInfinity() || other.isInfinity()) ? INF : ticks + other.ticks;
+			return *this;
+		}
+
+		FixedPoint& operator-=(FixedPoint other) {
+			ticks = (isInfinity()) ? INF : ticks - other.ticks;
+			return *this;
+		}
+
+		friend FixedPoint operator+(FixedPoint a, FixedPoint b) {
+			return a += b;
+		}
+
+		friend FixedPoint operator-(FixedPoint a, FixedPoint b) {
+			return a -= b;
+		}
+
+		friend constexpr bool operator==(FixedPoint a, FixedPoint b) { return a.ticks == b.ticks; }
+		friend constexpr bool operator!=(FixedPoint a, FixedPoint b) { return a.ticks != b.ticks; }
+		friend constexpr bool operator<(FixedPoint a, FixedPoint b) { return a.ticks < b.ticks; }
+		friend constexpr bool operator<=(FixedPoint a, FixedPoint b) { return a.ticks <= b.ticks; }
+		friend constexpr bool operator>(FixedPoint a, FixedPoint b) { return a.ticks > b.ticks; }
+		friend constexpr bool operator>=(FixedPoint a, FixedPoint b) { return a.ticks >= b.ticks; }
+
+		//! It inserts the time in an output stream in time units.
+		friend std::ostream& operator<<(std::ostream& out, FixedPoint t) {
+			return out << t.toDouble();
+		}
+
+		//! It extracts a time in time units from an input stream.
+		friend std::istream& operator>>(std::istream& in, FixedPoint& t) {
+			double value;
+			if (in >> value) {
+				t = value;
+			}
+			return in;
+		}
+	};
+
+	//! Integer simulation time (i.e., one tick per time unit).
+	using Ticks = FixedPoint<1>;
+
+	//! Traits of fixed-point times.
+	template <std::int64_t Scale>
+	struct TimeTraits<FixedPoint<Scale>> {
+		static constexpr FixedPoint<Scale> zero() {
+			return FixedPoint<Scale>();
+		}
+
+		static constexpr FixedPoint<Scale> infinity() {
+			return FixedPoint<Scale>::infinity();
+		}
+
+		static constexpr double toDouble(FixedPoint<Scale> t) {
+			return t.toDouble();
+		}
+
+		static std::int64_t bucket(FixedPoint<Scale> t, FixedPoint<Scale> width) {
+			auto q = t.getTicks() / width.getTicks();
+			return (t.getTicks() % width.getTicks() < 0) ? q - 1 : q;
+		}
+	};
+}
+
+//! Hash function of fixed-point times, so they can be used as keys of unordered containers.
+template <std::int64_t Scale>
+struct std::hash<cadmium::FixedPoint<Scale>> {
+	std::size_t operator()(cadmium::FixedPoint<Scale> t) const noexcept {
+		return std::hash<std::int64_t>()(t.getTicks());
+	}
+};
+
+#endif //CADMIUM_CORE_MODELING_TIME_HPP_
@@ -14,31 +14,41 @@
 #include <memory>
 #include "../logger/logger.hpp"
 #include "../modeling/component.hpp"
+#include "../modeling/time.hpp"
 
 namespace cadmium {
-	//! Abstract simulator class.
-    class AbstractSimulator {
+	/**
+	 * @brief Abstract simulator class.
+	 * @tparam T the data type used for representing the simulation time.
+	 */
+	template <typename T>
+    class BasicAbstractSimulator {
 	 protected:
-		long modelId;     //!< Model identification number.
-		double timeLast;  //!< Last simulation time.
-        double timeNext;  //!< Next simulation time.
+		long modelId;  //!< Model identification number.
+		T timeLast;    //!< Last simulation time.
+        T timeNext;    //!< Next simulation time.
 	 public:
 		/**
 		 * Constructor function.
 		 * @param time initial simulation time.
 		 */
-		AbstractSimulator(double time): modelId(), timeLast(time), timeNext(std::numeric_limits<double>::infinity()) {}
+		BasicAbstractSimulator(T time): modelId(), timeLast(time), timeNext(TimeTraits<T>::infinity()) {}
 
 		//! default destructor function.
-		virtual ~AbstractSimulator() = default;
+		virtual ~BasicAbstractSimulator() = default;
+
+		//! @return model identification number.
+		[[nodiscard]] long getModelId() const {
+			return modelId;
+		}
 
 		//! @return last simulation time.
-		[[nodiscard]] double getTimeLast() const {
+		[[nodiscard]] T getTimeLast() const {
 			return timeLast;
 		}
 
 		//! @return next simulation time.
-		[[nodiscard]] double getTimeNext() const {
+		[[nodiscard]] T getTimeNext() const {
 			return timeNext;
 		}
 
@@ -62,29 +72,32 @@ namespace cadmium {
 		 * It performs all the tasks needed before the simulation.
 		 * @param time initial simulation time.
 		 */
-		virtual void start(double time) = 0;
+		virtual void start(T time) = 0;
 
 		/**
 		 * It performs all the tasks needed after the simulation.
 		 * @param time last simulation time.
 		 */
-		virtual void stop(double time) = 0;
+		virtual void stop(T time) = 0;
 
 		/**
 		 * It executes the model collection function.
 		 * @param time simulation time.
 		 */
-		virtual void collection(double time) = 0;
+		virtual void collection(T time) = 0;
 
 		/**
 		 * It executes the model transition function.
 		 * @param time
 		 */
-		virtual void transition(double time) = 0;
+		virtual void transition(T time) = 0;
 
 		//! it clears the input and output ports of the model.
 		virtual void clear() = 0;
     };
+
+	//! Abstract simulator class for models that represent the simulation time with doubles.
+	using AbstractSimulator = BasicAbstractSimulator<double>;
 }
 
 #endif //CADMIUM_CORE_SIMULATION_ABS_SIMULATOR_HPP_
@@ -0,0 +1,219 @@
+/**
+ * Calendar queue for scheduling simulators.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_SIMULATION_CALENDAR_QUEUE_HPP_
+#define CADMIUM_CORE_SIMULATION_CALENDAR_QUEUE_HPP_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../exception.hpp"
+#include "../modeling/time.hpp"
+
+namespace cadmium {
+	/**
+	 * @brief Calendar queue of events.
+	 *
+	 * Each event corresponds to the next time of an element (e.g., a simulator) identified by its index.
+	 * Events are distributed among a circular array of buckets. Each bucket covers a time interval of fixed width,
+	 * and the array wraps around every "year" (i.e., number of buckets times the width of a bucket).
+	 * When most events are close to each other, finding and removing the next events are O(1) operations.
+	 * Rescheduling an element does not remove its previous event: stale events are discarded lazily.
+	 * With fixed-point times (e.g., Ticks), bucket indices are computed with integer arithmetic.
+	 * @tparam T the data type used for representing the simulation time.
+	 */
+	template <typename T>
+	class CalendarQueue {
+	 private:
+		using Event = std::pair<T, std::size_t>;  //!< Event as a pair <time, index of the element>.
+		T width;                                  //!< Width of the time interval covered by each bucket.
+		std::vector<std::vector<Event>> buckets;  //!< Circular array of buckets.
+		std::vector<T> scheduled;                 //!< Current next time of every element.
+		std::size_t nScheduled;                   //!< Number of elements with a finite next time.
+		std::size_t nEvents;                      //!< Number of events in the buckets (including stale events).
+		std::int64_t current;                     //!< Absolute index of the bucket of the next events.
+
+		//! @return true if an event is still valid (i.e., the element was not rescheduled).
+		[[nodiscard]] bool isValid(const Event& event) const {
+			return scheduled[event.second] == event.first;
+		}
+
+		//! @return reference to the bucket with a given absolute index.
+		std::vector<Event>& bucketAt(std::int64_t absolute) {
+			auto n = static_cast<std::int64_t>(buckets.size());
+			return buckets[((absolute % n) + n) % n];
+		}
+
+		/**
+		 * It removes the stale events of a bucket and looks for its earliest event within a given absolute bucket.
+		 * @param absolute absolute index of the bucket.
+		 * @return time of the earliest valid event of the bucket. If there are none, it returns infinity.
+		 */
+		T scan(std::int64_t absolute) {
+			auto& bucket = bucketAt(absolute);
+			auto res = TimeTraits<T>::infinity();
+			for (std::size_t i = 0; i < bucket.size();) {
+				if (!isValid(bucket[i])) {
+					bucket[i] = bucket.back();
+					bucket.pop_back();
+					nEvents--;
+					continue;
+				}
+				if (bucket[i].first < res && TimeTraits<T>::bucket(bucket[i].first, width) == absolute) {
+					res = bucket[i].first;
+				}
+				i++;
+			}
+			return res;
+		}
+
+		//! It doubles the number of buckets and redistributes all the valid events.
+		void grow() {
+			std::vector<Event> events;
+			events.reserve(nScheduled);
+			for (auto& bucket: buckets) {
+				for (const auto& event: bucket) {
+					if (isValid(event)) {
+						events.push_back(event);
+					}
+				}
+				bucket.clear();
+			}
+			buckets.resize(2 * buckets.size());
+			nEvents = 0;
+			for (const auto& event: events) {
+				bucketAt(TimeTraits<T>::bucket(event.first, width)).push_back(event);
+				nEvents++;
+			}
+		}
+	 public:
+		/**
+		 * Constructor function.
+		 * @param nElements number of elements to be scheduled.
+		 * @param width width of the time interval covered by each bucket. It must be greater than zero.
+		 * @param nBuckets initial number of buckets. The queue doubles it when there are too many events per bucket.
+		 */
+		CalendarQueue(std::size_t nElements, T width, std::size_t nBuckets):
+		  width(width), buckets(nBuckets), scheduled(nElements, TimeTraits<T>::infinity()), nScheduled(), nEvents(), current() {
+			if (!(TimeTraits<T>::zero() < width) || width == TimeTraits<T>::infinity()) {
+				throw CadmiumSimulationException("the width of calendar buckets must be positive and finite");
+			}
+			if (nBuckets == 0) {
+				throw CadmiumSimulationException("calendar queues need at least one bucket");
+			}
+		}
+
+		/**
+		 * It adds a new element to the queue. The new element is not scheduled.
+		 * @return index of the new element.
+		 */
+		std::size_t addElement() {
+			scheduled.push_back(TimeTraits<T>::infinity());
+			return scheduled.size() - 1;
+		}
+
+		//! @return number of elements with a finite next time.
+		[[nodiscard]] std::size_t size() const {
+			return nScheduled;
+		}
+
+		//! @return number of buckets.
+		[[nodiscard]] std::size_t nBuckets() const {
+			return buckets.size();
+		}
+
+		/**
+		 * @param i index of an element.
+		 * @return current next time of the element.
+		 */
+		[[nodiscard]] T getTime(std::size_t i) const {
+			return scheduled.at(i);
+		}
+
+		/**
+		 * It sets the next time of an element.
+		 * @param i index of the element.
+		 * @param time new next time of the element. If it is infinity, the element is not scheduled.
+		 */
+		void schedule(std::size_t i, T time) {
+			auto& previous = scheduled.at(i);
+			if (previous == time) {
+				return;
+			}
+			nScheduled += (previous == TimeTraits<T>::infinity()) ? 1 : 0;
+			previous = time;
+			if (time == TimeTraits<T>::infinity()) {
+				nScheduled--;
+				return;
+			}
+			auto absolute = TimeTraits<T>::bucket(time, width);
+			current = (nEvents == 0) ? absolute : std::min(current, absolute);
+			bucketAt(absolute).emplace_back(time, i);
+			if (++nEvents > 2 * buckets.size()) {
+				grow();
+			}
+		}
+
+		/**
+		 * It looks for the time of the next events. First, it visits the buckets of the current year.
+		 * If all of them are empty, it looks for the earliest event directly.
+		 * @return time of the next events. If no element is scheduled, it returns infinity.
+		 */
+		T nextTime() {
+			if (nScheduled == 0) {
+				return TimeTraits<T>::infinity();
+			}
+			auto n = static_cast<std::int64_t>(buckets.size());
+			for (std::int64_t k = 0; k < n; ++k) {
+				auto res = scan(current + k);
+				if (res != TimeTraits<T>::infinity()) {
+					current += k;
+					return res;
+				}
+			}
+			auto res = TimeTraits<T>::infinity();
+			for (std::int64_t k = 0; k < n; ++k) {
+				scan(k);  // we only want to remove the stale events here
+				for (const auto& event: bucketAt(k)) {
+					if (event.first < res) {
+						res = event.first;
+					}
+				}
+			}
+			current = TimeTraits<T>::bucket(res, width);
+			return res;
+		}
+
+		/**
+		 * It removes the next events from the queue. The corresponding elements are no longer scheduled.
+		 * @param imminent buffer where the indices of the elements of the next events are appended.
+		 * @return time of the next events. If no element is scheduled, it returns infinity.
+		 */
+		T pop(std::vector<std::size_t>& imminent) {
+			auto time = nextTime();
+			if (time == TimeTraits<T>::infinity()) {
+				return time;
+			}
+			auto& bucket = bucketAt(current);
+			for (std::size_t i = 0; i < bucket.size();) {
+				if (bucket[i].first == time && isValid(bucket[i])) {
+					imminent.push_back(bucket[i].second);
+					scheduled[bucket[i].second] = TimeTraits<T>::infinity();
+					nScheduled--;
+					bucket[i] = bucket.back();
+					bucket.pop_back();
+					nEvents--;
+				} else {
+					i++;
+				}
+			}
+			return time;
+		}
+	};
+}
+
+#endif //CADMIUM_CORE_SIMULATION_CALENDAR_QUEUE_HPP_
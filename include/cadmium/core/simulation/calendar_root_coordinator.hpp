@@ -0,0 +1,171 @@
+/**
+ * Root coordinator that schedules atomic models with a calendar queue.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_SIMULATION_CALENDAR_ROOT_COORDINATOR_HPP_
+#define CADMIUM_CORE_SIMULATION_CALENDAR_ROOT_COORDINATOR_HPP_
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "calendar_queue.hpp"
+#include "root_coordinator.hpp"
+#include "../exception.hpp"
+#include "../logger/logger.hpp"
+#include "../modeling/time.hpp"
+
+namespace cadmium {
+	/**
+	 * @brief Root coordinator that schedules atomic models with a calendar queue.
+	 *
+	 * The model is flattened, and the next times of its atomic models are kept in a calendar queue.
+	 * In every simulation step, only the imminent models and the models that receive messages from them are visited.
+	 * Messages are propagated in the same order as in the sequential coordinator, so simulations are equivalent.
+	 * It pays off when simulation steps only activate a small fraction of the models. Buckets should be as wide as
+	 * the usual time between consecutive events. Fixed-point times (e.g., Ticks) make bucket computations exact.
+	 * @tparam T the data type used for representing the simulation time.
+	 */
+	template <typename T>
+	class BasicCalendarRootCoordinator {
+	 private:
+		//! Internal coupling as a tuple <position in the IC set, port_from, port_to, index of the destination model>.
+		using IndexedCoupling = std::tuple<std::size_t, std::shared_ptr<PortInterface>, std::shared_ptr<PortInterface>, std::size_t>;
+		std::shared_ptr<BasicRootCoordinator<T>> rootCoordinator;  //!< Root coordinator of the flattened model.
+		std::vector<BasicAbstractSimulator<T> *> simulators;       //!< Simulators of the atomic models.
+		std::vector<std::vector<IndexedCoupling>> outgoingIC;      //!< For each atomic model, its outgoing ICs.
+		CalendarQueue<T> queue;                                    //!< Calendar queue with the next time of every model.
+		T timeLast;                                                //!< Time of the last simulation step.
+		std::vector<std::size_t> active;                           //!< Buffer with the models of a simulation step.
+		std::vector<const IndexedCoupling *> couplings;            //!< Buffer with the couplings of a simulation step.
+		std::vector<char> marked;                                  //!< For each model, true if it is in the active buffer.
+
+		/**
+		 * It runs a simulation step.
+		 * @param time simulation time of the step. It must be the time of the next events of the calendar queue.
+		 */
+		void simulationAdvance(T time) {
+			auto logger = rootCoordinator->getLogger();
+			if (logger != nullptr) {
+				logger->lock();
+				logger->logTime(TimeTraits<T>::toDouble(time));
+				logger->unlock();
+			}
+			active.clear();
+			queue.pop(active);
+			std::sort(active.begin(), active.end());
+			for (auto i: active) {
+				marked[i] = true;
+				simulators[i]->collection(time);
+				for (const auto& coupling: outgoingIC[i]) {
+					couplings.push_back(&coupling);
+				}
+			}
+			std::sort(couplings.begin(), couplings.end(), [](const IndexedCoupling * a, const IndexedCoupling * b) {
+				return std::get<0>(*a) < std::get<0>(*b);
+			});
+			for (const auto * coupling: couplings) {
+				const auto& [position, portFrom, portTo, to] = *coupling;
+				portTo->propagate(portFrom);
+				if (!marked[to]) {
+					marked[to] = true;
+					active.push_back(to);
+				}
+			}
+			couplings.clear();
+			for (auto i: active) {
+				simulators[i]->transition(time);
+				simulators[i]->clear();
+				queue.schedule(i, simulators[i]->getTimeNext());
+				marked[i] = false;
+			}
+			timeLast = time;
+		}
+	 public:
+		/**
+		 * Constructor function.
+		 * @param model pointer to the top coupled model. It is flattened.
+		 * @param time initial simulation time.
+		 * @param width width of the time interval covered by each bucket of the calendar queue.
+		 * @param nBuckets initial number of buckets of the calendar queue.
+		 */
+		BasicCalendarRootCoordinator(std::shared_ptr<Coupled> model, T time, T width, std::size_t nBuckets):
+		  rootCoordinator(), simulators(), outgoingIC(), queue(0, width, nBuckets),
+		  timeLast(time), active(), couplings(), marked() {
+			model->flatten();
+			rootCoordinator = std::make_shared<BasicRootCoordinator<T>>(model, time);
+			const auto& subcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents();
+			std::unordered_map<const Component*, std::size_t> indices;
+			for (std::size_t i = 0; i < subcomponents.size(); ++i) {
+				indices[subcomponents[i]->getComponent().get()] = i;
+				simulators.push_back(subcomponents[i].get());
+			}
+			queue = CalendarQueue<T>(simulators.size(), width, nBuckets);
+			outgoingIC.resize(simulators.size());
+			marked.resize(simulators.size());
+			const auto& ics = model->getSerialICs();
+			for (std::size_t position = 0; position < ics.size(); ++position) {
+				const auto& [portFrom, portTo] = ics[position];
+				outgoingIC[indices.at(portFrom->getParent())].emplace_back(position, portFrom, portTo, indices.at(portTo->getParent()));
+			}
+			for (std::size_t i = 0; i < simulators.size(); ++i) {
+				queue.schedule(i, simulators[i]->getTimeNext());
+			}
+		}
+
+		/**
+		 * Constructor function. The simulation starts at time zero, and the calendar queue has one bucket per model.
+		 * @param model pointer to the top coupled model. It is flattened.
+		 * @param width width of the time interval covered by each bucket of the calendar queue. By default, it is 1.
+		 */
+		explicit BasicCalendarRootCoordinator(std::shared_ptr<Coupled> model, T width = T(1)):
+		  BasicCalendarRootCoordinator(model, TimeTraits<T>::zero(), width, std::max<std::size_t>(1, model->getComponents().size())) {}
+
+		void setLogger(const std::shared_ptr<Logger>& log) {
+			rootCoordinator->setLogger(log);
+		}
+
+		void start() {
+			rootCoordinator->start();
+		}
+
+		void stop() {
+			rootCoordinator->stop();
+		}
+
+		[[maybe_unused]] void simulate(long nIterations) {
+			auto logger = rootCoordinator->getLogger();
+			if (logger != nullptr) {
+				logger->removeMutex();
+			}
+			T timeNext = queue.nextTime();
+			while (nIterations-- > 0 && timeNext < TimeTraits<T>::infinity()) {
+				simulationAdvance(timeNext);
+				timeNext = queue.nextTime();
+			}
+		}
+
+		[[maybe_unused]] void simulate(T timeInterval) {
+			auto logger = rootCoordinator->getLogger();
+			if (logger != nullptr) {
+				logger->removeMutex();
+			}
+			T timeNext = queue.nextTime();
+			T timeFinal = timeLast + timeInterval;
+			while (timeNext < timeFinal) {
+				simulationAdvance(timeNext);
+				timeNext = queue.nextTime();
+			}
+		}
+	};
+
+	//! Root coordinator that schedules atomic models with a calendar queue and represents the time with doubles.
+	using CalendarRootCoordinator = BasicCalendarRootCoordinator<double>;
+}
+
+#endif //CADMIUM_CORE_SIMULATION_CALENDAR_ROOT_COORDINATOR_HPP_
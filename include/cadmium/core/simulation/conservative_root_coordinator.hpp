@@ -0,0 +1,454 @@
+/**
+ * Conservative (Chandy-Misra-Bryant) parallel root coordinator.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_SIMULATION_CONSERVATIVE_ROOT_COORDINATOR_HPP_
+#define CADMIUM_CORE_SIMULATION_CONSERVATIVE_ROOT_COORDINATOR_HPP_
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <omp.h>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "deferred_logs.hpp"
+#include "root_coordinator.hpp"
+#include "virtual_time.hpp"
+#include "../exception.hpp"
+#include "../logger/logger.hpp"
+#include "../modeling/atomic.hpp"
+#include "../modeling/coupled.hpp"
+
+namespace cadmium {
+    //! Message exchanged between partitions of a conservative simulation.
+    struct ConservativeMessage {
+        VirtualTime vt;                            //!< Virtual time of the event that produced the message.
+        std::shared_ptr<PortInterface> portTo;     //!< Input port of the receiver model.
+        std::shared_ptr<const PortInterface> bag;  //!< Port with a copy of the messages.
+    };
+
+    //! Atomic model of a conservative simulation.
+    struct ConservativeModel {
+        std::shared_ptr<AtomicInterface> model;  //!< Pointer to the atomic model.
+        long modelId;                            //!< ID of the atomic model.
+        double timeLast;                         //!< Time of the last state transition.
+        VirtualTime timeNext;                    //!< Virtual time of the next internal transition.
+        //! Outgoing couplings to other partitions grouped by output port. Destinations are pairs <port_to, partition>.
+        std::vector<std::pair<std::shared_ptr<PortInterface>, std::vector<std::pair<std::shared_ptr<PortInterface>, std::size_t>>>> remote;
+        //! Outgoing couplings within the partition as pairs <port_from, port_to>.
+        std::vector<std::pair<std::shared_ptr<PortInterface>, std::shared_ptr<PortInterface>>> local;
+
+        ConservativeModel(std::shared_ptr<AtomicInterface> model, double timeLast, VirtualTime timeNext):
+            model(std::move(model)), modelId(), timeLast(timeLast), timeNext(timeNext), remote(), local() {}
+    };
+
+    //! Partition of a conservative simulation. Each partition is simulated by a different thread.
+    struct ConservativePartition {
+        std::mutex mutex;                           //!< Mutex for accessing the promise and the inbox of the partition.
+        VirtualTime promise;                        //!< The partition will not send messages with a lower virtual time.
+        std::vector<ConservativeMessage> inbox;     //!< Messages sent by other partitions and not received yet.
+        std::size_t first;                          //!< Index of the first model of the partition.
+        std::size_t last;                           //!< Index of the last model of the partition (not included).
+        std::vector<std::size_t> sources;           //!< Partitions that may send messages to this partition.
+        double lookahead;                           //!< Minimum lookahead of the models of the partition.
+        std::multimap<VirtualTime, ConservativeMessage> pending;  //!< Messages received and not processed yet.
+        bool collected;                             //!< It is true if the output functions of the next step were triggered.
+        std::vector<DeferredLog> logs;              //!< Log entries not forwarded to the logger yet.
+
+        ConservativePartition(): mutex(), promise(), inbox(), first(), last(), sources(),
+            lookahead(std::numeric_limits<double>::infinity()), pending(), collected(), logs() {}
+    };
+
+    /**
+     * @brief Conservative parallel root coordinator.
+     *
+     * It implements the Chandy-Misra-Bryant protocol. The atomic models of the flattened model are split in
+     * contiguous partitions, and each thread simulates one partition. Threads do not advance in lockstep.
+     * Instead, each partition executes its simulation steps as soon as it is safe to do so. Every partition
+     * promises the rest not to send messages with a lower virtual time than a given value. These promises
+     * depend on the lookahead of the atomic models (see AtomicInterface::lookahead). The greater the lookahead,
+     * the further partitions can advance independently. Output functions and state transitions are split:
+     * the output functions of a step can be triggered as soon as no earlier message can be received,
+     * and the state transitions once no message with the same virtual time can be received.
+     *
+     * When all the partitions are blocked (e.g., in zero-lookahead cycles), threads synchronize to compute
+     * the earliest virtual time of all the pending events. No partition can receive messages before it, so it
+     * becomes the new floor of all the promises. Logs are forwarded to the logger during these synchronizations.
+     */
+    class ConservativeRootCoordinator {
+     private:
+        std::shared_ptr<RootCoordinator> rootCoordinator;  //!< Root coordinator used for starting and stopping the simulation.
+        std::vector<ConservativeModel> models;             //!< Atomic models of the simulation.
+        std::unordered_map<const Component*, std::size_t> indices;  //!< Index of each atomic model.
+        unsigned int idleSpins;                            //!< Iterations without progress before threads synchronize.
+
+        /**
+         * It computes the earliest virtual time of a message sent as a response to an input message.
+         * @param vt virtual time of the input message.
+         * @param lookahead lookahead of the receiver.
+         * @return earliest virtual time of the response.
+         */
+        static VirtualTime after(const VirtualTime& vt, double lookahead) {
+            return (vt == VirtualTime::infinity()) ? vt : vt.advance(lookahead);
+        }
+
+     public:
+        ConservativeRootCoordinator(std::shared_ptr<Coupled> model, double time): idleSpins(100) {
+            model->flatten();  // In parallel execution, models MUST be flat
+            rootCoordinator = std::make_shared<RootCoordinator>(model, time);
+            for (const auto& simulator: rootCoordinator->getTopCoordinator()->getSubcomponents()) {
+                auto atomic = std::dynamic_pointer_cast<AtomicInterface>(simulator->getComponent());
+                if (atomic == nullptr) {
+                    throw CadmiumSimulationException("conservative simulation requires a flat model");
+                }
+                indices[atomic.get()] = models.size();
+                models.emplace_back(atomic, simulator->getTimeLast(), VirtualTime(simulator->getTimeNext(), 0));
+            }
+        }
+        explicit ConservativeRootCoordinator(std::shared_ptr<Coupled> model): ConservativeRootCoordinator(std::move(model), 0) {}
+
+        void setLogger(const std::shared_ptr<Logger>& log) {
+            rootCoordinator->setLogger(log);
+        }
+
+        /**
+         * It sets the number of consecutive iterations without progress before a thread waits for the rest of threads.
+         * @param spins number of iterations.
+         */
+        void setIdleSpins(unsigned int spins) {
+            idleSpins = spins;
+        }
+
+        void start() {
+            rootCoordinator->start();
+            const auto& subcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents();
+            for (std::size_t i = 0; i < models.size(); ++i) {
+                models[i].modelId = subcomponents[i]->getModelId();
+            }
+        }
+
+        void stop() {
+            rootCoordinator->stop();
+        }
+
+        void simulate(double timeInterval, unsigned int thread_number = std::thread::hardware_concurrency()) {
+            auto logger = rootCoordinator->getLogger();
+            // Logs are forwarded by only one thread
+            if (logger != nullptr) {
+                logger->removeMutex();
+            }
+            double timeFinal = rootCoordinator->getTopCoordinator()->getTimeLast() + timeInterval;
+            // Floors and commit bounds are double-buffered, so we can reset one of them while the other is being reduced
+            VirtualTime floors[2] = {VirtualTime(), VirtualTime::infinity()};
+            VirtualTime bounds[2] = {VirtualTime(), VirtualTime::infinity()};
+            std::vector<ConservativePartition> partitions(thread_number);
+            std::vector<std::vector<DeferredLog>> committed(thread_number);
+            std::exception_ptr error;  // exceptions must not escape the parallel region
+
+			#pragma omp parallel default(shared) num_threads(thread_number)
+            {
+                std::size_t tid = omp_get_thread_num();
+                std::size_t nThreads = omp_get_num_threads();
+				#pragma omp single
+                {
+                    buildPartitions(partitions, nThreads);
+                }
+                auto& partition = partitions[tid];
+                auto floor = floors[0];
+                std::size_t epoch = 1;
+                while (true) {
+                    unsigned int spins = 0;
+                    try {
+                        while (spins < idleSpins) {
+                            // First, we compute the earliest input time of the partition
+                            auto eit = VirtualTime::infinity();
+                            for (auto source: partition.sources) {
+                                std::lock_guard<std::mutex> lock(partitions[source].mutex);
+                                eit = std::min(eit, partitions[source].promise);
+                            }
+                            eit = std::max(eit, floor);
+                            // Then, we receive messages from other partitions. They must be received AFTER reading promises
+                            {
+                                std::lock_guard<std::mutex> lock(partition.mutex);
+                                for (auto& msg: partition.inbox) {
+                                    partition.pending.emplace(msg.vt, std::move(msg));
+                                }
+                                partition.inbox.clear();
+                            }
+                            // Next, we advance as much as possible
+                            bool progress = advance(partitions, tid, eit, timeFinal, logger != nullptr);
+                            // Finally, we update the promise of the partition. It must be updated AFTER sending messages
+                            auto promise = this->promise(partition, eit);
+                            {
+                                std::lock_guard<std::mutex> lock(partition.mutex);
+                                partition.promise = promise;
+                            }
+                            if (progress) {
+                                spins = 0;
+                            } else {
+                                ++spins;
+                                std::this_thread::yield();
+                            }
+                        }
+                    } catch (...) {
+						#pragma omp critical
+                        error = std::current_exception();
+                    }
+
+                    // All the threads synchronize to compute the new floor
+					#pragma omp barrier
+                    if (tid == 0) {
+                        floors[(epoch + 1) % 2] = VirtualTime::infinity();
+                        bounds[(epoch + 1) % 2] = VirtualTime::infinity();
+                    }
+                    auto [localFloor, localBound] = this->floor(partition);
+                    bool failed;
+					#pragma omp critical
+                    {
+                        floors[epoch % 2] = std::min(floors[epoch % 2], localFloor);
+                        bounds[epoch % 2] = std::min(bounds[epoch % 2], localBound);
+                        failed = error != nullptr;  // errors are only raised before the first barrier
+                    }
+					#pragma omp barrier
+                    floor = floors[epoch % 2];
+                    auto bound = bounds[epoch++ % 2];
+                    if (failed) {
+                        break;  // all the threads stop in the same epoch
+                    }
+
+                    // Logs of events before the commit bound are forwarded to the logger
+                    if (logger != nullptr) {
+                        moveDeferredLogs(partition.logs, committed[tid], bound);
+						#pragma omp barrier
+						#pragma omp single
+                        {
+                            commitDeferredLogs(logger, committed, rootCoordinator->getTopCoordinator()->getSubcomponents());
+                        }
+                    }
+                    if (floor.time >= timeFinal) {
+                        break;
+                    }
+                }
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+     private:
+        /**
+         * It splits the atomic models in contiguous partitions and classifies the couplings of each model.
+         * @param partitions vector of partitions.
+         * @param nPartitions number of partitions. It may be less than the size of the vector of partitions.
+         */
+        void buildPartitions(std::vector<ConservativePartition>& partitions, std::size_t nPartitions) {
+            auto nModels = models.size();
+            auto owner = [nModels, nPartitions](std::size_t i) {
+                return ((i + 1) * nPartitions - 1) / nModels;
+            };
+            for (std::size_t p = 0; p < nPartitions; ++p) {
+                partitions[p].first = nModels * p / nPartitions;
+                partitions[p].last = nModels * (p + 1) / nPartitions;
+            }
+            for (auto& m: models) {
+                m.local.clear();
+                m.remote.clear();
+            }
+            std::set<std::pair<std::size_t, std::size_t>> channels;
+            std::unordered_map<const PortInterface*, std::size_t> remoteIndices;
+            for (const auto& [portFrom, portTo]: rootCoordinator->getTopCoordinator()->getCoupled()->getSerialICs()) {
+                auto from = indices.at(portFrom->getParent());
+                auto to = indices.at(portTo->getParent());
+                auto& m = models[from];
+                if (owner(from) == owner(to)) {
+                    m.local.emplace_back(portFrom, portTo);
+                    continue;
+                }
+                if (remoteIndices.find(portFrom.get()) == remoteIndices.end()) {
+                    remoteIndices[portFrom.get()] = m.remote.size();
+                    m.remote.emplace_back(portFrom, std::vector<std::pair<std::shared_ptr<PortInterface>, std::size_t>>());
+                }
+                m.remote[remoteIndices.at(portFrom.get())].second.emplace_back(portTo, owner(to));
+                channels.emplace(owner(from), owner(to));
+            }
+            for (const auto& [from, to]: channels) {
+                partitions[to].sources.push_back(from);
+            }
+            for (std::size_t p = 0; p < nPartitions; ++p) {
+                for (auto i = partitions[p].first; i < partitions[p].last; ++i) {
+                    partitions[p].lookahead = std::min(partitions[p].lookahead, models[i].model->lookahead());
+                }
+            }
+        }
+
+        /**
+         * @param partition partition.
+         * @return earliest virtual time of the internal transitions of the models of the partition.
+         */
+        [[nodiscard]] VirtualTime nextInternal(const ConservativePartition& partition) const {
+            auto next = VirtualTime::infinity();
+            for (auto i = partition.first; i < partition.last; ++i) {
+                next = std::min(next, models[i].timeNext);
+            }
+            return next;
+        }
+
+        /**
+         * It executes all the simulation steps of a partition that are safe.
+         * @param partitions vector of partitions.
+         * @param p index of the partition.
+         * @param eit earliest input time of the partition.
+         * @param timeFinal final simulation time.
+         * @param logging if true, log entries are buffered.
+         * @return true if the partition made any progress.
+         */
+        bool advance(std::vector<ConservativePartition>& partitions, std::size_t p, const VirtualTime& eit, double timeFinal, bool logging) {
+            auto& partition = partitions[p];
+            bool progress = false;
+            while (true) {
+                auto internal = nextInternal(partition);
+                auto vt = (partition.pending.empty()) ? internal : std::min(internal, partition.pending.begin()->first);
+                if (vt.time >= timeFinal) {
+                    return progress;
+                }
+                if (!partition.collected) {
+                    // Output functions only depend on messages with lower virtual time
+                    if (internal == vt && eit < vt) {
+                        return progress;
+                    }
+                    if (internal == vt) {
+                        collection(partitions, p, vt, logging);
+                    }
+                    partition.collected = true;
+                    progress = true;
+                }
+                // State transitions also depend on messages with the same virtual time
+                if (eit <= vt) {
+                    return progress;
+                }
+                transition(partition, vt, logging);
+                partition.collected = false;
+            }
+        }
+
+        /**
+         * It triggers the output functions of the imminent models of a partition and routes the resulting messages.
+         * @param partitions vector of partitions.
+         * @param p index of the partition.
+         * @param vt virtual time of the simulation step.
+         * @param logging if true, log entries are buffered.
+         */
+        void collection(std::vector<ConservativePartition>& partitions, std::size_t p, const VirtualTime& vt, bool logging) {
+            auto& partition = partitions[p];
+            for (auto i = partition.first; i < partition.last; ++i) {
+                auto& m = models[i];
+                if (m.timeNext != vt) {
+                    continue;
+                }
+                m.model->output();
+                for (const auto& [portFrom, portTo]: m.local) {
+                    portTo->propagate(portFrom);
+                }
+                for (const auto& [portFrom, destinations]: m.remote) {
+                    if (portFrom->empty()) {
+                        continue;
+                    }
+                    std::shared_ptr<PortInterface> bag = portFrom->newCompatiblePort(portFrom->getId());
+                    bag->propagate(portFrom);
+                    for (const auto& [portTo, to]: destinations) {
+                        std::lock_guard<std::mutex> lock(partitions[to].mutex);
+                        partitions[to].inbox.push_back({vt, portTo, bag});
+                    }
+                }
+                if (logging) {
+                    for (const auto& outPort: m.model->getOutPorts()) {
+                        for (std::size_t j = 0; j < outPort->size(); ++j) {
+                            partition.logs.push_back({vt, m.modelId, outPort->getId(), outPort->logMessage(j), false});
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * It triggers the state transitions of the imminent models and the models with input messages of a partition.
+         * @param partition reference to the partition.
+         * @param vt virtual time of the simulation step.
+         * @param logging if true, log entries are buffered.
+         */
+        void transition(ConservativePartition& partition, const VirtualTime& vt, bool logging) {
+            while (!partition.pending.empty() && partition.pending.begin()->first == vt) {
+                const auto& msg = partition.pending.begin()->second;
+                msg.portTo->propagate(msg.bag);
+                partition.pending.erase(partition.pending.begin());
+            }
+            for (auto i = partition.first; i < partition.last; ++i) {
+                auto& m = models[i];
+                auto inEmpty = m.model->inEmpty();
+                if (inEmpty && m.timeNext != vt) {
+                    continue;
+                }
+                if (inEmpty) {
+                    m.model->internalTransition();
+                } else {
+                    auto e = vt.time - m.timeLast;
+                    (m.timeNext == vt) ? m.model->confluentTransition(e) : m.model->externalTransition(e);
+                }
+                if (logging) {
+                    partition.logs.push_back({vt, m.modelId, "", m.model->logState(), true});
+                }
+                m.model->clearPorts();
+                m.timeLast = vt.time;
+                m.timeNext = vt.advance(m.model->timeAdvance());
+            }
+        }
+
+        /**
+         * It computes the promise of a partition (i.e., a lower bound of the virtual time of its next messages).
+         * The partition may send messages when its models are imminent or as a response to input messages.
+         * @param partition reference to the partition.
+         * @param eit earliest input time of the partition.
+         * @return promise of the partition.
+         */
+        [[nodiscard]] VirtualTime promise(const ConservativePartition& partition, const VirtualTime& eit) const {
+            auto internal = nextInternal(partition);
+            if (partition.collected) {
+                // Output functions of the next step were already triggered
+                auto vt = (partition.pending.empty()) ? internal : std::min(internal, partition.pending.begin()->first);
+                internal = vt.advance(0);
+            }
+            auto input = (partition.pending.empty()) ? eit : std::min(eit, partition.pending.begin()->first);
+            return std::min(internal, after(input, partition.lookahead));
+        }
+
+        /**
+         * It computes the contribution of a partition to the floor of the promises and the commit bound.
+         * The floor is the virtual time of the earliest message that any partition may send regardless of its inputs.
+         * The commit bound is the virtual time of the earliest simulation step that any partition may execute.
+         * Threads MUST be synchronized, so the partition cannot receive new messages.
+         * @param partition reference to the partition.
+         * @return pair <floor, commit bound>.
+         */
+        [[nodiscard]] std::pair<VirtualTime, VirtualTime> floor(const ConservativePartition& partition) const {
+            auto next = nextInternal(partition);
+            auto input = (partition.pending.empty()) ? VirtualTime::infinity() : partition.pending.begin()->first;
+            for (const auto& msg: partition.inbox) {
+                input = std::min(input, msg.vt);
+            }
+            auto bound = std::min(next, input);
+            auto floor = (partition.collected) ? std::min(next, input).advance(0) : next;
+            return {std::min(floor, after(input, 0)), bound};
+        }
+    };
+}
+
+#endif //CADMIUM_CORE_SIMULATION_CONSERVATIVE_ROOT_COORDINATOR_HPP_
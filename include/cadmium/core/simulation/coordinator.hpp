@@ -20,11 +20,18 @@
 #include "../modeling/component.hpp"
 
 namespace cadmium {
-	//! DEVS sequential coordinator class.
-    class Coordinator: public AbstractSimulator {
+	/**
+	 * @brief DEVS sequential coordinator class.
+	 * @tparam T the data type used for representing the simulation time.
+	 */
+	template <typename T>
+    class BasicCoordinator: public BasicAbstractSimulator<T> {
      private:
-        std::shared_ptr<Coupled> model;                              //!< Pointer to coupled model of the coordinator.
-        std::vector<std::shared_ptr<AbstractSimulator>> simulators;  //!< Vector of child simulators.
+        using BasicAbstractSimulator<T>::modelId;
+        using BasicAbstractSimulator<T>::timeLast;
+        using BasicAbstractSimulator<T>::timeNext;
+        std::shared_ptr<Coupled> model;                                      //!< Pointer to coupled model of the coordinator.
+        std::vector<std::shared_ptr<BasicAbstractSimulator<T>>> simulators;  //!< Vector of child simulators.
 	 public:
 		/**
 		 * Constructor function.
@@ -32,22 +39,22 @@ namespace cadmium {
 		 * @param time initial simulation time.
 		 * @param parallel if true, simulators will use mutexes for logging.
 		 */
-        Coordinator(std::shared_ptr<Coupled> model, double time): AbstractSimulator(time), model(std::move(model)) {
+        BasicCoordinator(std::shared_ptr<Coupled> model, T time): BasicAbstractSimulator<T>(time), model(std::move(model)) {
 			if (this->model == nullptr) {
 				throw CadmiumSimulationException("no coupled model provided");
 			}
 			timeLast = time;
-			for (auto& [componentId, component]: this->model->getComponents()) {
-				std::shared_ptr<AbstractSimulator> simulator;
+			for (const auto& component: this->model->getOrderedComponents()) {
+				std::shared_ptr<BasicAbstractSimulator<T>> simulator;
 				auto coupled = std::dynamic_pointer_cast<Coupled>(component);
 				if (coupled != nullptr) {
-					simulator = std::make_shared<Coordinator>(coupled, time);
+					simulator = std::make_shared<BasicCoordinator<T>>(coupled, time);
 				} else {
-					auto atomic = std::dynamic_pointer_cast<AtomicInterface>(component);
+					auto atomic = std::dynamic_pointer_cast<BasicAtomicInterface<T>>(component);
 					if (atomic == nullptr) {
-						throw CadmiumSimulationException("component is not a coupled nor atomic model");
+						throw CadmiumSimulationException("component is not a coupled nor atomic model with the same time type");
 					}
-					simulator = std::make_shared<Simulator>(atomic, time);
+					simulator = std::make_shared<BasicSimulator<T>>(atomic, time);
 				}
 				simulators.push_back(simulator);
 				timeNext = std::min(timeNext, simulator->getTimeNext());
@@ -65,10 +72,24 @@ namespace cadmium {
         }
 
 		//! @return pointer to subcomponents.
-		[[nodiscard]] const std::vector<std::shared_ptr<AbstractSimulator>>& getSubcomponents() {
+		[[nodiscard]] const std::vector<std::shared_ptr<BasicAbstractSimulator<T>>>& getSubcomponents() {
 			return simulators;
 		}
 
+		/**
+		 * It replaces a child atomic simulator with a copy created by the calling thread.
+		 * It also re-allocates the state of the corresponding atomic model from the calling thread.
+		 * Parallel simulators use it to place simulators on the memory of the NUMA node that executes them.
+		 * @param i index of the child simulator. Child coordinators are left as they are.
+		 */
+		void relocateSubcomponent(std::size_t i) {
+			auto simulator = std::dynamic_pointer_cast<BasicSimulator<T>>(simulators.at(i));
+			if (simulator != nullptr) {
+				simulators[i] = std::make_shared<BasicSimulator<T>>(*simulator);
+				std::static_pointer_cast<BasicAtomicInterface<T>>(simulator->getComponent())->relocateState();
+			}
+		}
+
 		/**
 		 * Sets the model ID of its coupled model and all the models of its child simulators.
 		 * @param next next available model ID.
@@ -83,13 +104,13 @@ namespace cadmium {
 		}
 
 		//! It updates the initial simulation time and calls to the start method of all its child simulators.
-		void start(double time) override {
+		void start(T time) override {
 			timeLast = time;
 			std::for_each(simulators.begin(), simulators.end(), [time](auto& s) { s->start(time); });
 		}
 
 		//! It  updates the final simulation time and calls to the stop method of all its child simulators.
-		void stop(double time) override {
+		void stop(T time) override {
 			timeLast = time;
 			std::for_each(simulators.begin(), simulators.end(), [time](auto& s) { s->stop(time); });
 		}
@@ -98,7 +119,7 @@ namespace cadmium {
 		 * It collects all the output messages and propagates them according to the ICs and EOCs.
 		 * @param time new simulation time.
 		 */
-		void collection(double time) override {
+		void collection(T time) override {
 			if (time >= timeNext) {
 				std::for_each(simulators.begin(), simulators.end(), [time](auto& s) { s->collection(time); });
                 for (auto& [portFrom, portTo]: model->getSerialICs()) {
@@ -114,12 +135,12 @@ namespace cadmium {
 		 * It propagates input messages according to the EICs and triggers the state transition function of child components.
 		 * @param time new simulation time.
 		 */
-		void transition(double time) override {
+		void transition(T time) override {
             for (auto& [portFrom, portTo]: model->getSerialEICs()) {
                 portTo->propagate(portFrom);
             }
 			timeLast = time;
-			timeNext = std::numeric_limits<double>::infinity();
+			timeNext = TimeTraits<T>::infinity();
 			for (auto& simulator: simulators) {
 				simulator->transition(time);
 				timeNext = std::min(timeNext, simulator->getTimeNext());
@@ -140,6 +161,9 @@ namespace cadmium {
 			std::for_each(simulators.begin(), simulators.end(), [log](auto& s) { s->setLogger(log); });
 		}
     };
+
+	//! DEVS sequential coordinator class for models that represent the simulation time with doubles.
+	using Coordinator = BasicCoordinator<double>;
 }
 
 #endif //CADMIUM_CORE_SIMULATION_COORDINATOR_HPP_
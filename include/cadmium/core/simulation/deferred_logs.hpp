@@ -0,0 +1,100 @@
+/**
+ * Deferred logging for parallel simulators that do not share a global simulation loop.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_SIMULATION_DEFERRED_LOGS_HPP_
+#define CADMIUM_CORE_SIMULATION_DEFERRED_LOGS_HPP_
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "abs_simulator.hpp"
+#include "virtual_time.hpp"
+#include "../logger/logger.hpp"
+
+namespace cadmium {
+    //! Log entry that is buffered until it is safe to forward it to the logger.
+    struct DeferredLog {
+        VirtualTime vt;      //!< Virtual time of the logged event.
+        long modelId;        //!< ID of the model.
+        std::string port;    //!< Name of the output port. It is empty for state logs.
+        std::string value;   //!< String representation of the output message or the model state.
+        bool state;          //!< If true, it is a state log. Otherwise, it is an output message log.
+    };
+
+    //! Logger that stores log entries in a buffer of deferred logs. It is not thread-safe, so every thread needs its own.
+    class DeferredLogger: public Logger {
+     private:
+        std::vector<DeferredLog>& buffer;  //!< Buffer of deferred logs.
+     public:
+        /**
+         * Constructor function.
+         * @param buffer buffer in which log entries are stored.
+         */
+        explicit DeferredLogger(std::vector<DeferredLog>& buffer): Logger(), buffer(buffer) {}
+
+        void start() override {}
+
+        void stop() override {}
+
+        void logOutput(double time, long modelId, const std::string&, const std::string& portName, const std::string& output) override {
+            buffer.push_back({VirtualTime(time, 0), modelId, portName, output, false});
+        }
+
+        void logState(double time, long modelId, const std::string&, const std::string& state) override {
+            buffer.push_back({VirtualTime(time, 0), modelId, "", state, true});
+        }
+    };
+
+    /**
+     * It moves the deferred logs with a virtual time less than a given bound from one buffer to another.
+     * @param from buffer of deferred logs sorted by virtual time.
+     * @param to destination buffer.
+     * @param bound upper bound (not included) of the virtual time of the logs to be moved.
+     */
+    inline void moveDeferredLogs(std::vector<DeferredLog>& from, std::vector<DeferredLog>& to, const VirtualTime& bound) {
+        auto it = std::find_if(from.begin(), from.end(), [&bound](const auto& log) {
+            return log.vt >= bound;
+        });
+        to.insert(to.end(), std::make_move_iterator(from.begin()), std::make_move_iterator(it));
+        from.erase(from.begin(), it);
+    }
+
+    /**
+     * It forwards deferred logs to a logger in the same order as a sequential simulator would do.
+     * Entries are sorted by virtual time and model ID. Output messages go before the new state of the model.
+     * @param logger pointer to the logger.
+     * @param buffers buffers with deferred log entries. They are cleared after being logged.
+     * @param subcomponents child simulators of a flat top coordinator. They must have consecutive model IDs.
+     */
+    inline void commitDeferredLogs(const std::shared_ptr<Logger>& logger, std::vector<std::vector<DeferredLog>>& buffers,
+                                   const std::vector<std::shared_ptr<AbstractSimulator>>& subcomponents) {
+        std::vector<DeferredLog> logs;
+        for (auto& buffer: buffers) {
+            logs.insert(logs.end(), std::make_move_iterator(buffer.begin()), std::make_move_iterator(buffer.end()));
+            buffer.clear();
+        }
+        std::stable_sort(logs.begin(), logs.end(), [](const auto& a, const auto& b) {
+            return a.vt < b.vt || (a.vt == b.vt && (a.modelId < b.modelId || (a.modelId == b.modelId && !a.state && b.state)));
+        });
+        auto firstId = (subcomponents.empty()) ? 0 : subcomponents.front()->getModelId();
+        std::optional<VirtualTime> lastVt;
+        for (const auto& log: logs) {
+            if (!lastVt.has_value() || lastVt.value() != log.vt) {
+                logger->logTime(log.vt.time);
+                lastVt = log.vt;
+            }
+            const auto& modelName = subcomponents[log.modelId - firstId]->getComponent()->getId();
+            (log.state) ? logger->logState(log.vt.time, log.modelId, modelName, log.value) :
+                logger->logOutput(log.vt.time, log.modelId, modelName, log.port, log.value);
+        }
+    }
+}
+
+#endif //CADMIUM_CORE_SIMULATION_DEFERRED_LOGS_HPP_
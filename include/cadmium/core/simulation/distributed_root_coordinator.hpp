@@ -0,0 +1,212 @@
+/**
+ * Root coordinator for distributed simulation across several processes.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_SIMULATION_DISTRIBUTED_ROOT_COORDINATOR_HPP_
+#define CADMIUM_CORE_SIMULATION_DISTRIBUTED_ROOT_COORDINATOR_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "coordinator.hpp"
+#include "../exception.hpp"
+#include "../logger/logger.hpp"
+#include "../modeling/coupled.hpp"
+#include "../transport/transport.hpp"
+
+namespace cadmium {
+    /**
+     * @brief Root coordinator for distributed simulation.
+     *
+     * Every process builds the same model, which is flattened. Then, atomic models are split in contiguous
+     * partitions, and each process only simulates the atomic models of its rank. Couplings between models
+     * of the same rank are propagated locally. Messages of couplings between models of different ranks are
+     * serialized and sent through the transport. Processes synchronize the simulation time at every step.
+     * Each process logs the outputs and states of its own models in its own logger.
+     */
+    class DistributedRootCoordinator {
+     private:
+        std::shared_ptr<Coordinator> topCoordinator;  //!< Pointer to top coordinator.
+        std::shared_ptr<Transport> transport;         //!< Pointer to the transport.
+        std::shared_ptr<Logger> logger;               //!< Pointer to simulation logger.
+        double timeLast;                              //!< Time of the last simulation step.
+        std::size_t first;                            //!< Index of the first atomic model of the process.
+        std::size_t last;                             //!< Index of the last atomic model of the process (not included).
+        //! Couplings between models of the process as pairs <port_from, port_to>.
+        std::vector<std::pair<std::shared_ptr<PortInterface>, std::shared_ptr<PortInterface>>> localICs;
+        //! Couplings from models of the process to models of other processes as pairs <coupling index, port_from>.
+        std::vector<std::vector<std::pair<std::uint64_t, std::shared_ptr<PortInterface>>>> outgoingICs;
+        //! Destination port of the couplings from models of other processes to models of the process.
+        std::unordered_map<std::uint64_t, std::shared_ptr<PortInterface>> incomingICs;
+
+        //! @return the time of the next internal transition of the models of the process.
+        [[nodiscard]] double localTimeNext() const {
+            auto timeNext = std::numeric_limits<double>::infinity();
+            const auto& subcomponents = topCoordinator->getSubcomponents();
+            for (auto i = first; i < last; ++i) {
+                timeNext = std::min(timeNext, subcomponents[i]->getTimeNext());
+            }
+            return timeNext;
+        }
+
+        //! It sends the output messages to other processes and injects the messages received from other processes.
+        void exchange() {
+            std::vector<std::vector<char>> outgoing(transport->getSize());
+            for (std::size_t rank = 0; rank < outgoingICs.size(); ++rank) {
+                for (const auto& [index, portFrom]: outgoingICs[rank]) {
+                    if (!portFrom->empty()) {
+                        Serializer<std::uint64_t>::write(outgoing[rank], index);
+                        portFrom->serialize(outgoing[rank]);
+                    }
+                }
+            }
+            auto incoming = transport->allToAll(std::move(outgoing));
+            for (const auto& buffer: incoming) {
+                const char* cursor = buffer.data();
+                const char* end = buffer.data() + buffer.size();
+                while (cursor < end) {
+                    auto index = Serializer<std::uint64_t>::read(cursor, end);
+                    incomingICs.at(index)->deserialize(cursor, end);
+                }
+            }
+        }
+
+        void simulationAdvance(double timeNext) {
+            if (logger != nullptr) {
+                logger->logTime(timeNext);
+            }
+            const auto& subcomponents = topCoordinator->getSubcomponents();
+            for (auto i = first; i < last; ++i) {
+                subcomponents[i]->collection(timeNext);
+            }
+            for (const auto& [portFrom, portTo]: localICs) {
+                portTo->propagate(portFrom);
+            }
+            exchange();
+            for (auto i = first; i < last; ++i) {
+                subcomponents[i]->transition(timeNext);
+                subcomponents[i]->clear();
+            }
+            timeLast = timeNext;
+        }
+
+     public:
+        /**
+         * Constructor function. All the processes must build the same model in the same order.
+         * @param model pointer to the model to be simulated. It is flattened.
+         * @param transport pointer to the transport used for communicating with the rest of processes.
+         * @param time initial simulation time.
+         */
+        DistributedRootCoordinator(std::shared_ptr<Coupled> model, std::shared_ptr<Transport> transport, double time):
+            topCoordinator(), transport(std::move(transport)), logger(), timeLast(time), first(), last(), localICs(), outgoingICs(), incomingICs() {
+            if (this->transport == nullptr) {
+                throw CadmiumSimulationException("no transport provided");
+            }
+            model->flatten();  // In distributed execution, models MUST be flat
+            topCoordinator = std::make_shared<Coordinator>(model, time);
+            const auto& subcomponents = topCoordinator->getSubcomponents();
+            auto nModels = subcomponents.size();
+            auto nRanks = static_cast<std::size_t>(this->transport->getSize());
+            auto rank = static_cast<std::size_t>(this->transport->getRank());
+            first = nModels * rank / nRanks;
+            last = nModels * (rank + 1) / nRanks;
+
+            std::unordered_map<const Component*, std::size_t> owners;
+            for (std::size_t r = 0; r < nRanks; ++r) {
+                for (auto i = nModels * r / nRanks; i < nModels * (r + 1) / nRanks; ++i) {
+                    owners[subcomponents[i]->getComponent().get()] = r;
+                }
+            }
+            outgoingICs.resize(nRanks);
+            std::uint64_t index = 0;
+            for (const auto& [portFrom, portTo]: model->getSerialICs()) {
+                auto from = owners.at(portFrom->getParent());
+                auto to = owners.at(portTo->getParent());
+                if (from == rank && to == rank) {
+                    localICs.emplace_back(portFrom, portTo);
+                } else if (from == rank) {
+                    outgoingICs[to].emplace_back(index, portFrom);
+                } else if (to == rank) {
+                    incomingICs[index] = portTo;
+                }
+                ++index;
+            }
+        }
+        DistributedRootCoordinator(std::shared_ptr<Coupled> model, std::shared_ptr<Transport> transport):
+            DistributedRootCoordinator(std::move(model), std::move(transport), 0) {}
+
+        void setLogger(const std::shared_ptr<Logger>& log) {
+            logger = log;
+            const auto& subcomponents = topCoordinator->getSubcomponents();
+            for (auto i = first; i < last; ++i) {
+                subcomponents[i]->setLogger(log);
+            }
+        }
+
+        std::shared_ptr<Logger> getLogger() {
+            return logger;
+        }
+
+        std::shared_ptr<Coordinator> getTopCoordinator() {
+            return topCoordinator;
+        }
+
+        std::shared_ptr<Transport> getTransport() {
+            return transport;
+        }
+
+        void start() {
+            if (logger != nullptr) {
+                logger->start();
+            }
+            topCoordinator->setModelId(0);
+            const auto& subcomponents = topCoordinator->getSubcomponents();
+            for (auto i = first; i < last; ++i) {
+                subcomponents[i]->start(timeLast);
+            }
+        }
+
+        void stop() {
+            const auto& subcomponents = topCoordinator->getSubcomponents();
+            for (auto i = first; i < last; ++i) {
+                subcomponents[i]->stop(timeLast);
+            }
+            if (logger != nullptr) {
+                logger->stop();
+            }
+        }
+
+        [[maybe_unused]] void simulate(long nIterations) {
+            // Firsts, we make sure that Mutexes are not activated
+            if (logger != nullptr) {
+                logger->removeMutex();
+            }
+            double timeNext = transport->allReduceMin(localTimeNext());
+            while (nIterations-- > 0 && timeNext < std::numeric_limits<double>::infinity()) {
+                simulationAdvance(timeNext);
+                timeNext = transport->allReduceMin(localTimeNext());
+            }
+        }
+
+        [[maybe_unused]] void simulate(double timeInterval) {
+            // Firsts, we make sure that Mutexes are not activated
+            if (logger != nullptr) {
+                logger->removeMutex();
+            }
+            double timeNext = transport->allReduceMin(localTimeNext());
+            double timeFinal = timeLast + timeInterval;
+            while (timeNext < timeFinal) {
+                simulationAdvance(timeNext);
+                timeNext = transport->allReduceMin(localTimeNext());
+            }
+        }
+    };
+}
+
+#endif //CADMIUM_CORE_SIMULATION_DISTRIBUTED_ROOT_COORDINATOR_HPP_
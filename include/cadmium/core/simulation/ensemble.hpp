@@ -0,0 +1,133 @@
+/**
+ * Ensemble of independent simulation replications.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_SIMULATION_ENSEMBLE_HPP_
+#define CADMIUM_CORE_SIMULATION_ENSEMBLE_HPP_
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "root_coordinator.hpp"
+#include "../exception.hpp"
+#include "../logger/logger.hpp"
+#include "../modeling/coupled.hpp"
+
+namespace cadmium {
+    /**
+     * @brief Runner for many independent replications of a model in a single process.
+     *
+     * Every replication builds its own model with a model factory and runs it with its own sequential
+     * root coordinator. Replications are distributed dynamically among threads. Expensive parts of
+     * the model that do not change during the simulation (e.g., configurations parsed from JSON files)
+     * should be built once and captured by the model factory, so replications only create their own state.
+     * @tparam R data type of the result of a replication.
+     */
+    template <typename R>
+    class Ensemble {
+     public:
+        //! Function that builds the model of a replication. Its argument is the replication index.
+        using ModelFactory = std::function<std::shared_ptr<Coupled>(std::size_t)>;
+        //! Function that builds the logger of a replication. It may return nullptr.
+        using LoggerFactory = std::function<std::shared_ptr<Logger>(std::size_t)>;
+        //! Function that computes the result of a replication once its simulation is over.
+        using ResultFunction = std::function<R(std::size_t, const std::shared_ptr<Coupled>&)>;
+
+     private:
+        ModelFactory modelFactory;    //!< Model factory.
+        ResultFunction result;        //!< Result function.
+        LoggerFactory loggerFactory;  //!< Logger factory. If empty, replications do not log.
+        std::size_t nReplications;    //!< Number of replications.
+
+     public:
+        /**
+         * Constructor function.
+         * @param modelFactory function that builds the model of each replication.
+         * @param result function that computes the result of each replication.
+         * @param nReplications number of replications.
+         */
+        Ensemble(ModelFactory modelFactory, ResultFunction result, std::size_t nReplications):
+            modelFactory(std::move(modelFactory)), result(std::move(result)), loggerFactory(), nReplications(nReplications) {
+            if (this->modelFactory == nullptr || this->result == nullptr) {
+                throw CadmiumSimulationException("ensembles need a model factory and a result function");
+            }
+        }
+
+        /**
+         * It sets the logger factory. Each replication must log to a different logger.
+         * @param factory function that builds the logger of each replication.
+         */
+        void setLoggerFactory(LoggerFactory factory) {
+            loggerFactory = std::move(factory);
+        }
+
+        //! @return number of replications.
+        [[nodiscard]] std::size_t getNReplications() const {
+            return nReplications;
+        }
+
+        /**
+         * It runs all the replications.
+         * @param timeInterval simulation time of each replication.
+         * @param thread_number number of threads to be used.
+         * @return results of the replications, sorted by replication index.
+         * @throw the first exception thrown by any replication, if any.
+         */
+        std::vector<R> simulate(double timeInterval, unsigned int thread_number = std::thread::hardware_concurrency()) {
+            std::vector<std::unique_ptr<R>> partialResults(nReplications);
+            std::vector<std::exception_ptr> errors(nReplications);
+            long n = static_cast<long>(nReplications);
+
+			#pragma omp parallel for num_threads(thread_number) schedule(dynamic)
+            for (long i = 0; i < n; ++i) {
+                // Exceptions cannot leave the parallel region, so we rethrow them afterwards
+                try {
+                    partialResults[i] = std::make_unique<R>(runReplication(i, timeInterval));
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            }
+            for (const auto& error: errors) {
+                if (error != nullptr) {
+                    std::rethrow_exception(error);
+                }
+            }
+            std::vector<R> results;
+            results.reserve(nReplications);
+            for (auto& partial: partialResults) {
+                results.push_back(std::move(*partial));
+            }
+            return results;
+        }
+
+     private:
+        /**
+         * It runs one replication.
+         * @param i replication index.
+         * @param timeInterval simulation time of the replication.
+         * @return result of the replication.
+         */
+        R runReplication(std::size_t i, double timeInterval) {
+            auto model = modelFactory(i);
+            auto rootCoordinator = RootCoordinator(model);
+            if (loggerFactory != nullptr) {
+                auto logger = loggerFactory(i);
+                if (logger != nullptr) {
+                    rootCoordinator.setLogger(logger);
+                }
+            }
+            rootCoordinator.start();
+            rootCoordinator.simulate(timeInterval);
+            rootCoordinator.stop();
+            return result(i, model);
+        }
+    };
+}
+
+#endif //CADMIUM_CORE_SIMULATION_ENSEMBLE_HPP_
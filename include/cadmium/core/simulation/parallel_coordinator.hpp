@@ -0,0 +1,181 @@
+/**
+ * DEVS parallel coordinator class.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_SIMULATION_PARALLEL_COORDINATOR_HPP_
+#define CADMIUM_CORE_SIMULATION_PARALLEL_COORDINATOR_HPP_
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "abs_simulator.hpp"
+#include "simulator.hpp"
+#include "../modeling/atomic.hpp"
+#include "../modeling/coupled.hpp"
+#include "../modeling/component.hpp"
+
+namespace cadmium {
+    /**
+     * DEVS parallel coordinator class. It does not require flattening the model.
+     * Child simulators are executed as OpenMP tasks. Therefore, the coordinator must be used within a parallel region.
+     * Only imminent child components and child components with incoming messages are scheduled.
+     * Child components are cleared right after their state transition.
+     */
+    class ParallelCoordinator: public AbstractSimulator {
+     private:
+        std::shared_ptr<Coupled> model;                              //!< Pointer to coupled model of the coordinator.
+        std::vector<std::shared_ptr<AbstractSimulator>> simulators;  //!< Vector of child simulators.
+        std::vector<AbstractSimulator*> active;                      //!< Child simulators scheduled in the current step.
+     public:
+        /**
+         * Constructor function.
+         * @param model pointer to the coordinator coupled model.
+         * @param time initial simulation time.
+         */
+        ParallelCoordinator(std::shared_ptr<Coupled> model, double time): AbstractSimulator(time), model(std::move(model)) {
+            if (this->model == nullptr) {
+                throw CadmiumSimulationException("no coupled model provided");
+            }
+            timeLast = time;
+            for (const auto& component: this->model->getOrderedComponents()) {
+                std::shared_ptr<AbstractSimulator> simulator;
+                auto coupled = std::dynamic_pointer_cast<Coupled>(component);
+                if (coupled != nullptr) {
+                    simulator = std::make_shared<ParallelCoordinator>(coupled, time);
+                } else {
+                    auto atomic = std::dynamic_pointer_cast<AtomicInterface>(component);
+                    if (atomic == nullptr) {
+                        throw CadmiumSimulationException("component is not a coupled nor atomic model");
+                    }
+                    simulator = std::make_shared<Simulator>(atomic, time);
+                }
+                simulators.push_back(simulator);
+                timeNext = std::min(timeNext, simulator->getTimeNext());
+            }
+            active.reserve(simulators.size());
+        }
+
+        //! @return pointer to the coupled model of the coordinator.
+        [[nodiscard]] std::shared_ptr<Component> getComponent() const override {
+            return model;
+        }
+
+        //! @return pointer to the coupled model of the coordinator without upcasting it to an abstract Component.
+        [[nodiscard]] std::shared_ptr<Coupled> getCoupled() const {
+            return model;
+        }
+
+        //! @return pointer to subcomponents.
+        [[nodiscard]] const std::vector<std::shared_ptr<AbstractSimulator>>& getSubcomponents() {
+            return simulators;
+        }
+
+        /**
+         * Sets the model ID of its coupled model and all the models of its child simulators.
+         * @param next next available model ID.
+         * @return next available model ID after assiging the ID to all the child models.
+         */
+        long setModelId(long next) override {
+            modelId = next++;
+            for (auto& simulator: simulators) {
+                next = simulator->setModelId(next);
+            }
+            return next;
+        }
+
+        //! It updates the initial simulation time and calls to the start method of all its child simulators.
+        void start(double time) override {
+            timeLast = time;
+            std::for_each(simulators.begin(), simulators.end(), [time](auto& s) { s->start(time); });
+        }
+
+        //! It  updates the final simulation time and calls to the stop method of all its child simulators.
+        void stop(double time) override {
+            timeLast = time;
+            std::for_each(simulators.begin(), simulators.end(), [time](auto& s) { s->stop(time); });
+        }
+
+        /**
+         * It collects in parallel the output messages of imminent children and propagates them according to the ICs and EOCs.
+         * @param time new simulation time.
+         */
+        void collection(double time) override {
+            if (time >= timeNext) {
+                active.clear();
+                for (auto& simulator: simulators) {
+                    if (time >= simulator->getTimeNext()) {
+                        active.push_back(simulator.get());
+                    }
+                }
+                runActive([time](AbstractSimulator* s) { s->collection(time); });
+                for (auto& [portFrom, portTo]: model->getSerialICs()) {
+                    portTo->propagate(portFrom);
+                }
+                for (auto& [portFrom, portTo]: model->getSerialEOCs()) {
+                    portTo->propagate(portFrom);
+                }
+            }
+        }
+
+        /**
+         * It propagates input messages according to the EICs and triggers in parallel the state transition function
+         * of imminent children and children with incoming messages. Next, it clears the ports of these children.
+         * @param time new simulation time.
+         */
+        void transition(double time) override {
+            for (auto& [portFrom, portTo]: model->getSerialEICs()) {
+                portTo->propagate(portFrom);
+            }
+            active.clear();
+            for (auto& simulator: simulators) {
+                if (time >= simulator->getTimeNext() || !simulator->getComponent()->inEmpty()) {
+                    active.push_back(simulator.get());
+                }
+            }
+            runActive([time](AbstractSimulator* s) {
+                s->transition(time);
+                s->clear();
+            });
+            timeLast = time;
+            timeNext = std::numeric_limits<double>::infinity();
+            for (auto& simulator: simulators) {
+                timeNext = std::min(timeNext, simulator->getTimeNext());
+            }
+        }
+
+        //! It clears the messages from the ports of its coupled model. Child components are cleared after their transition.
+        void clear() override {
+            model->clearPorts();
+        }
+
+        /**
+         * It sets the logger to all the child components.
+         * @param log pointer to the new logger.
+         */
+        void setLogger(const std::shared_ptr<Logger>& log) override {
+            std::for_each(simulators.begin(), simulators.end(), [log](auto& s) { s->setLogger(log); });
+        }
+
+     private:
+        /**
+         * It applies a function to all the active child simulators. If there are more than one, it spawns OpenMP tasks.
+         * @tparam F type of the function to apply.
+         * @param f function to apply to every active child simulator.
+         */
+        template <typename F>
+        void runActive(F f) {
+            auto nActive = (long) active.size();
+			#pragma omp taskloop default(shared) if(nActive > 1)
+            for (long i = 0; i < nActive; ++i) {
+                f(active[i]);
+            }
+        }
+    };
+}
+
+#endif //CADMIUM_CORE_SIMULATION_PARALLEL_COORDINATOR_HPP_
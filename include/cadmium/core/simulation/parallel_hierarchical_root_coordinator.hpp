@@ -0,0 +1,108 @@
+/**
+ * Root coordinator for parallel simulation of hierarchical (i.e., not flattened) models.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_SIMULATION_PARALLEL_HIERARCHICAL_ROOT_COORDINATOR_HPP_
+#define CADMIUM_CORE_SIMULATION_PARALLEL_HIERARCHICAL_ROOT_COORDINATOR_HPP_
+
+#include <limits>
+#include <memory>
+#include <thread>
+#include <utility>
+#include "parallel_coordinator.hpp"
+#include "../logger/logger.hpp"
+
+namespace cadmium {
+    /**
+     * Parallel root coordinator that keeps the model hierarchy.
+     * One thread drives the simulation loop, while the coordinator tree spawns OpenMP tasks across the children
+     * of every coupled model. The remaining threads of the team execute these tasks.
+     */
+    class ParallelHierarchicalRootCoordinator {
+     protected:
+        std::shared_ptr<ParallelCoordinator> topCoordinator;  //!< Pointer to top coordinator.
+        std::shared_ptr<Logger> logger;                       //!< Pointer to simulation logger.
+
+        void simulationAdvance(double timeNext) {
+            if (logger != nullptr) {
+                logger->lock();
+                logger->logTime(timeNext);
+                logger->unlock();
+            }
+            topCoordinator->collection(timeNext);
+            topCoordinator->transition(timeNext);
+            topCoordinator->clear();
+        }
+
+     public:
+        ParallelHierarchicalRootCoordinator(std::shared_ptr<Coupled> model, double time):
+            topCoordinator(std::make_shared<ParallelCoordinator>(std::move(model), time)), logger() {}
+        explicit ParallelHierarchicalRootCoordinator(std::shared_ptr<Coupled> model): ParallelHierarchicalRootCoordinator(std::move(model), 0) {}
+
+        void setLogger(const std::shared_ptr<Logger>& log) {
+            logger = log;
+            topCoordinator->setLogger(log);
+        }
+
+        std::shared_ptr<Logger> getLogger() {
+            return logger;
+        }
+
+        std::shared_ptr<ParallelCoordinator> getTopCoordinator() {
+            return topCoordinator;
+        }
+
+        void start() {
+            if (logger != nullptr) {
+                logger->start();
+            }
+            topCoordinator->setModelId(0);
+            topCoordinator->start(topCoordinator->getTimeLast());
+        }
+
+        void stop() {
+            topCoordinator->stop(topCoordinator->getTimeLast());
+            if (logger != nullptr) {
+                logger->stop();
+            }
+        }
+
+        [[maybe_unused]] void simulate(long nIterations, unsigned int thread_number = std::thread::hardware_concurrency()) {
+            // First, we make sure that Mutexes are activated
+            if (logger != nullptr) {
+                logger->createMutex();
+            }
+			#pragma omp parallel num_threads(thread_number)
+			#pragma omp single
+            {
+                double timeNext = topCoordinator->getTimeNext();
+                while (nIterations-- > 0 && timeNext < std::numeric_limits<double>::infinity()) {
+                    simulationAdvance(timeNext);
+                    timeNext = topCoordinator->getTimeNext();
+                }
+            }
+        }
+
+        [[maybe_unused]] void simulate(double timeInterval, unsigned int thread_number = std::thread::hardware_concurrency()) {
+            // First, we make sure that Mutexes are activated
+            if (logger != nullptr) {
+                logger->createMutex();
+            }
+			#pragma omp parallel num_threads(thread_number)
+			#pragma omp single
+            {
+                double timeNext = topCoordinator->getTimeNext();
+                double timeFinal = topCoordinator->getTimeLast() + timeInterval;
+                while (timeNext < timeFinal) {
+                    simulationAdvance(timeNext);
+                    timeNext = topCoordinator->getTimeNext();
+                }
+            }
+        }
+    };
+}
+
+#endif //CADMIUM_CORE_SIMULATION_PARALLEL_HIERARCHICAL_ROOT_COORDINATOR_HPP_
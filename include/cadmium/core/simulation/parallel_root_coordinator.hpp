@@ -11,13 +11,24 @@
 #ifndef CADMIUM_CORE_SIMULATION_PARALLEL_ROOT_COORDINATOR_HPP_
 #define CADMIUM_CORE_SIMULATION_PARALLEL_ROOT_COORDINATOR_HPP_
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <omp.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
 #include <thread>
+#include <tuple>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <utility>
 #include <vector>
+#include "deferred_logs.hpp"
 #include "root_coordinator.hpp"
+#include "../exception.hpp"
 #include "../logger/logger.hpp"
 
 #include <iostream>
@@ -29,13 +40,352 @@ namespace cadmium {
     	std::shared_ptr<RootCoordinator> rootCoordinator;
         //! It serializes the IC couplings in pairs <port_to, {ports_from}> to parallelize message propagation.
         std::vector<std::pair<std::shared_ptr<PortInterface>, std::vector<std::shared_ptr<PortInterface>>>> stackedIC;
+        //! Internal coupling as a tuple <port_from, port_to, index of the destination subcomponent>.
+        using IndexedCoupling = std::tuple<std::shared_ptr<PortInterface>, std::shared_ptr<PortInterface>, std::size_t>;
+        //! For each subcomponent, its outgoing ICs.
+        std::vector<std::vector<IndexedCoupling>> outgoingIC;
+        //! Weakly connected clusters of subcomponents. Each cluster contains the indices of its subcomponents.
+        std::vector<std::vector<std::size_t>> clusters;
+        static constexpr std::size_t CACHE_LINE = 64;                //!< Size (in bytes) of a cache line.
+        static constexpr long CHUNK = CACHE_LINE / sizeof(double);  //!< Maximum number of child simulators per batch.
+        /**
+         * Function that triggers a simulation phase on a batch of child simulators.
+         * Its arguments are the simulators, the size of the batch, the simulation time, and the next time array.
+         * It returns the number of simulators that were activated (only for the state transition phase).
+         */
+        using BatchFunction = std::size_t(*)(Simulator * const *, std::size_t, double, double *);
+        //! Consecutive child simulators (in type-grouped order) whose atomic models have the same dynamic type.
+        struct AtomicBatch {
+            std::type_index type;       //!< Dynamic type of the atomic models.
+            std::size_t first;          //!< Position of the first simulator of the batch.
+            std::size_t last;           //!< Position after the last simulator of the batch.
+            BatchFunction collection;   //!< Function that triggers the output functions of the batch.
+            BatchFunction transition;   //!< Function that triggers the state transitions of the batch.
+        };
+        std::vector<std::size_t> typeOrder;  //!< Indices of the child simulators grouped by the type of their atomic model.
+        std::vector<std::size_t> positions;  //!< Position of every child simulator in the type-grouped order.
+        std::vector<Simulator *> grouped;    //!< Child simulators grouped by the type of their atomic model.
+        std::vector<AtomicBatch> batches;    //!< Batches of child simulators. Simulation phases run batch by batch.
+        //! If true, messages and log entries are processed in a canonical order. Thus, simulations are reproducible.
+        bool deterministic;
+        //! Affinity map. The i-th thread runs on the CPU affinity[i % affinity.size()]. If empty, threads are not pinned.
+        std::vector<int> affinity;
+        static constexpr double SMOOTHING = 0.125;  //!< Weight of new samples in the moving averages of execution times.
+        std::size_t serialThreshold;  //!< Steps after a step with fewer active models than this are run by a single thread.
+        bool adaptiveThreshold;       //!< If true, the serial threshold is learned from the execution times of the steps.
+        double parallelStepTime;      //!< Moving average of the execution time of parallel steps.
+        double serialActivationTime;  //!< Moving average of the execution time per active model of serial steps.
+        bool zeroTimeCascade;         //!< If true, zero-time follow-up steps are run as micro-steps by a single thread.
+
+        /**
+         * It finds the representative of a subcomponent in a union-find forest.
+         * @param parent union-find forest.
+         * @param i index of the subcomponent.
+         * @return index of the representative subcomponent.
+         */
+        static std::size_t findRoot(std::vector<std::size_t>& parent, std::size_t i) {
+            while (parent[i] != i) {
+                parent[i] = parent[parent[i]];  // path halving
+                i = parent[i];
+            }
+            return i;
+        }
+
+        //! It groups the subcomponents in weakly connected clusters using the ICs.
+        void buildClusters() {
+            auto nSubcomponents = outgoingIC.size();
+            std::vector<std::size_t> parent(nSubcomponents);
+            for (std::size_t i = 0; i < nSubcomponents; ++i) {
+                parent[i] = i;
+            }
+            for (std::size_t from = 0; from < nSubcomponents; ++from) {
+                for (const auto& coupling: outgoingIC[from]) {
+                    auto a = findRoot(parent, from);
+                    auto b = findRoot(parent, std::get<2>(coupling));
+                    // The lowest index is the representative, so clusters are sorted by their first subcomponent
+                    if (a < b) {
+                        parent[b] = a;
+                    } else {
+                        parent[a] = b;
+                    }
+                }
+            }
+            std::vector<std::size_t> clusterIndex(nSubcomponents);
+            for (std::size_t i = 0; i < nSubcomponents; ++i) {
+                auto root = findRoot(parent, i);
+                if (root == i) {
+                    clusterIndex[i] = clusters.size();
+                    clusters.emplace_back();
+                }
+                clusters[clusterIndex[root]].push_back(i);
+            }
+        }
+
+        /**
+         * It triggers the output functions of a batch of child simulators with atomic models of type T.
+         * @tparam T dynamic type of the atomic models. It must be final or AtomicInterface (i.e., virtual calls).
+         * @param simulators pointer to the first simulator of the batch.
+         * @param n number of simulators in the batch.
+         * @param time current simulation time.
+         */
+        template <typename T>
+        static std::size_t collectionBatch(Simulator * const * simulators, std::size_t n, double time, double *) {
+            for (std::size_t i = 0; i < n; ++i) {
+                simulators[i]->template collection<T>(time);
+            }
+            return 0;
+        }
+
+        /**
+         * It triggers the state transitions of a batch of child simulators with atomic models of type T.
+         * Then, it clears the ports of the models and stores their next time.
+         * @tparam T dynamic type of the atomic models. It must be final or AtomicInterface (i.e., virtual calls).
+         * @param simulators pointer to the first simulator of the batch.
+         * @param n number of simulators in the batch.
+         * @param time current simulation time.
+         * @param timeNexts pointer to the next time of the first simulator of the batch.
+         * @return number of simulators that triggered a state transition.
+         */
+        template <typename T>
+        static std::size_t transitionBatch(Simulator * const * simulators, std::size_t n, double time, double * timeNexts) {
+            std::size_t activity = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                simulators[i]->template transition<T>(time);
+                simulators[i]->Simulator::clear();
+                timeNexts[i] = simulators[i]->getTimeNext();
+                activity += simulators[i]->getTimeLast() == time;
+            }
+            return activity;
+        }
+
+        /**
+         * It groups the child simulators by the dynamic type of their atomic models and splits them in batches.
+         * Groups follow the order of the first appearance of each type. Batches never contain more than CHUNK
+         * simulators, and they never cross a chunk boundary. Initially, all the batches use virtual dispatch.
+         */
+        void groupByType() {
+            const auto& subcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents();
+            std::vector<std::type_index> types;
+            std::unordered_map<std::type_index, std::size_t> groups;
+            for (const auto& subcomponent: subcomponents) {
+                const auto& component = *subcomponent->getComponent();
+                types.emplace_back(typeid(component));
+                groups.emplace(types.back(), groups.size());
+            }
+            typeOrder.resize(subcomponents.size());
+            for (std::size_t i = 0; i < typeOrder.size(); ++i) {
+                typeOrder[i] = i;
+            }
+            std::stable_sort(typeOrder.begin(), typeOrder.end(), [&types, &groups](std::size_t a, std::size_t b) {
+                return groups.at(types[a]) < groups.at(types[b]);
+            });
+            positions.resize(typeOrder.size());
+            for (std::size_t k = 0; k < typeOrder.size(); ++k) {
+                positions[typeOrder[k]] = k;
+            }
+            for (std::size_t k = 0; k < typeOrder.size(); ++k) {
+                const auto& type = types[typeOrder[k]];
+                if (batches.empty() || k % CHUNK == 0 || batches.back().type != type) {
+                    batches.push_back({type, k, k + 1, &collectionBatch<AtomicInterface>, &transitionBatch<AtomicInterface>});
+                } else {
+                    batches.back().last++;
+                }
+            }
+            updateGroupedSimulators();
+        }
+
+        /**
+         * It updates the pointers to the child simulators in type-grouped order.
+         * @throw CadmiumSimulationException if any child simulator is not an atomic simulator.
+         */
+        void updateGroupedSimulators() {
+            const auto& subcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents();
+            grouped.resize(typeOrder.size());
+            for (std::size_t k = 0; k < typeOrder.size(); ++k) {
+                auto simulator = std::dynamic_pointer_cast<Simulator>(subcomponents[typeOrder[k]]);
+                if (simulator == nullptr) {
+                    throw CadmiumSimulationException("parallel coordinator only works with flat models");
+                }
+                grouped[k] = simulator.get();
+            }
+        }
+
+        /**
+         * It allocates an array for the next time of every child simulator aligned to a cache line.
+         * The array follows the type-grouped order. As batches never cross a cache line of the array,
+         * threads only write on the same cache line when it contains more than one batch.
+         * @param buffer buffer used for allocating the array.
+         * @return pointer to the first element of the array.
+         */
+        double * alignedTimes(std::vector<double>& buffer) {
+            auto nSubcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents().size();
+            buffer.resize(nSubcomponents + CHUNK);
+            void * ptr = buffer.data();
+            auto space = buffer.size() * sizeof(double);
+            return static_cast<double *>(std::align(CACHE_LINE, nSubcomponents * sizeof(double), ptr, space));
+        }
+
+        /**
+         * It pins the calling thread to its CPU in the affinity map (if any).
+         * Pinning is just a hint for improving memory locality, so failures are silently ignored.
+         * @param tid ID of the calling thread.
+         */
+        void pinThread(std::size_t tid) const {
+            if (affinity.empty()) {
+                return;
+            }
+#ifdef __linux__
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            CPU_SET(affinity[tid % affinity.size()], &cpus);
+            sched_setaffinity(0, sizeof(cpus), &cpus);
+#endif
+        }
+
+        /**
+         * It makes the child simulators of the calling thread log to a buffer of deferred logs.
+         * It must be called by all the threads, as the loop uses the same static schedule as the simulation steps.
+         * Therefore, every simulator always runs in the thread that owns its buffer.
+         * @param buffer buffer of deferred logs of the calling thread.
+         */
+        void setDeferredLoggers(std::vector<DeferredLog>& buffer) {
+            auto deferredLogger = std::make_shared<DeferredLogger>(buffer);
+            long nBatches = batches.size();
+			#pragma omp for schedule(static)
+            for (long b = 0; b < nBatches; b++) {
+                for (auto k = batches[b].first; k < batches[b].last; ++k) {
+                    grouped[k]->setLogger(deferredLogger);
+                }
+            }
+        }
+
+        /**
+         * It runs a micro-step in the calling thread. Only the given imminent models and the models that receive
+         * messages from them are visited. Messages are propagated in ascending model ID order of their origin.
+         * @param time simulation time of the micro-step.
+         * @param timeNexts array with the next time of every child simulator (in type-grouped order).
+         * @param active positions of the imminent simulators. They must be marked. Afterwards, it contains the
+         * positions of all the simulators that triggered a state transition.
+         * @param marked buffer of flags. A flag is set if the simulator in the same position is in the active buffer.
+         * @return number of active models (i.e., models that triggered a state transition).
+         */
+        std::size_t microStep(double time, double * timeNexts, std::vector<std::size_t>& active, std::vector<char>& marked) {
+            std::sort(active.begin(), active.end(), [this](std::size_t a, std::size_t b) {
+                return typeOrder[a] < typeOrder[b];
+            });
+            auto nImminent = active.size();
+            for (std::size_t j = 0; j < nImminent; ++j) {
+                auto k = active[j];
+                grouped[k]->collection(time);
+                for (const auto& [portFrom, portTo, to]: outgoingIC[typeOrder[k]]) {
+                    portTo->propagate(portFrom);
+                    if (!marked[positions[to]]) {
+                        marked[positions[to]] = true;
+                        active.push_back(positions[to]);
+                    }
+                }
+            }
+            for (auto k: active) {
+                grouped[k]->transition(time);
+                grouped[k]->clear();
+                timeNexts[k] = grouped[k]->getTimeNext();
+                marked[k] = false;
+            }
+            return active.size();
+        }
+
+        /**
+         * It runs the zero-time follow-up steps of a micro-step in the calling thread.
+         * Models that did not trigger a state transition in a micro-step cannot become imminent at the same time.
+         * Thus, the imminent models of the next micro-step are picked from the active models of the previous one,
+         * and the next time array is not scanned again until the zero-time chain is over.
+         * @param time simulation time of the zero-time chain.
+         * @param timeNexts array with the next time of every child simulator (in type-grouped order).
+         * @param active positions of the simulators that triggered a state transition in the last micro-step.
+         * @param marked buffer of flags. A flag is set if the simulator in the same position is in the active buffer.
+         * @return number of active models in all the micro-steps of the chain.
+         */
+        std::size_t cascade(double time, double * timeNexts, std::vector<std::size_t>& active, std::vector<char>& marked) {
+            std::size_t activity = 0;
+            while (true) {
+                active.erase(std::remove_if(active.begin(), active.end(), [time, timeNexts](std::size_t k) {
+                    return timeNexts[k] != time;
+                }), active.end());
+                if (active.empty()) {
+                    return activity;
+                }
+                for (auto k: active) {
+                    marked[k] = true;
+                }
+                activity += microStep(time, timeNexts, active, marked);
+            }
+        }
+
+        /**
+         * It runs a simulation step in the calling thread. Only imminent models and the models that receive
+         * messages from them are visited. Messages are propagated in ascending model ID order of their origin.
+         * If zero-time cascades are enabled, the zero-time follow-up steps are run as part of this step.
+         * @param time simulation time of the step.
+         * @param timeNexts array with the next time of every child simulator (in type-grouped order).
+         * @param active buffer for the positions of the active simulators.
+         * @param marked buffer of flags. A flag is set if the simulator in the same position is in the active buffer.
+         * @return number of active models (i.e., models that triggered a state transition).
+         */
+        std::size_t serialStep(double time, double * timeNexts, std::vector<std::size_t>& active, std::vector<char>& marked) {
+            active.clear();
+            for (std::size_t k = 0; k < grouped.size(); ++k) {
+                if (timeNexts[k] == time) {
+                    active.push_back(k);
+                    marked[k] = true;
+                }
+            }
+            auto activity = microStep(time, timeNexts, active, marked);
+            return (zeroTimeCascade) ? activity + cascade(time, timeNexts, active, marked) : activity;
+        }
+
+        /**
+         * It decides whether the next simulation step must be run by a single thread.
+         * With an adaptive threshold, a step is serial if its estimated serial execution time is less than
+         * the execution time of a parallel step. Serial steps are tried first until their cost is known.
+         * @param activity number of active models in the last simulation step.
+         * @return true if the next simulation step must be run by a single thread.
+         */
+        [[nodiscard]] bool runSerial(std::size_t activity) const {
+            if (adaptiveThreshold) {
+                return serialActivationTime == 0 || (double) activity * serialActivationTime < parallelStepTime;
+            }
+            return activity < serialThreshold;
+        }
+
+        /**
+         * It updates a moving average of execution times.
+         * @param average moving average to be updated.
+         * @param sample new execution time.
+         */
+        static void updateTime(double& average, double sample) {
+            average = (average == 0) ? sample : (1 - SMOOTHING) * average + SMOOTHING * sample;
+        }
+
      public:
-        ParallelRootCoordinator(std::shared_ptr<Coupled> model, double time) {
+        ParallelRootCoordinator(std::shared_ptr<Coupled> model, double time): deterministic(), affinity(), serialThreshold(),
+          adaptiveThreshold(), parallelStepTime(), serialActivationTime(), zeroTimeCascade() {
             model->flatten();  // In parallel execution, models MUST be flat
             rootCoordinator = std::make_shared<RootCoordinator>(model, time);
             for (const auto& [portTo, portsFrom]: model->getICs()) {
                 stackedIC.emplace_back(portTo, portsFrom);
             }
+            const auto& subcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents();
+            std::unordered_map<const Component*, std::size_t> indices;
+            for (std::size_t i = 0; i < subcomponents.size(); ++i) {
+                indices[subcomponents[i]->getComponent().get()] = i;
+            }
+            outgoingIC.resize(subcomponents.size());
+            for (const auto& [portFrom, portTo]: model->getSerialICs()) {
+                auto from = indices.at(portFrom->getParent());
+                outgoingIC[from].emplace_back(portFrom, portTo, indices.at(portTo->getParent()));
+            }
+            buildClusters();
+            groupByType();
         }
         explicit ParallelRootCoordinator(std::shared_ptr<Coupled> model): ParallelRootCoordinator(std::move(model), 0) {}
 
@@ -43,6 +393,166 @@ namespace cadmium {
 			rootCoordinator->setLogger(log);
 		}
 
+        /**
+         * It registers an atomic model type. Batches of models of this type are simulated through functions
+         * specialized for T. As T is final, the compiler calls (and may inline) the functions of the model
+         * without virtual dispatch. The methods of AtomicInterface must be visible in T (i.e., not hidden by
+         * overloads declared in T, see DEVStoneAtomic).
+         * @tparam T dynamic type of the atomic models. It must be final.
+         */
+        template <typename T>
+        void registerAtomicType() {
+            static_assert(std::is_base_of_v<AtomicInterface, T>, "registered types must be atomic models");
+            static_assert(std::is_final_v<T>, "registered types must be final");
+            for (auto& batch: batches) {
+                if (batch.type == std::type_index(typeid(T))) {
+                    batch.collection = &collectionBatch<T>;
+                    batch.transition = &transitionBatch<T>;
+                }
+            }
+        }
+
+        //! @return weakly connected clusters of subcomponents. Clusters do not exchange messages with each other.
+        [[nodiscard]] const std::vector<std::vector<std::size_t>>& getClusters() const {
+            return clusters;
+        }
+
+        /**
+         * It enables or disables the deterministic mode of the simulate methods.
+         * In deterministic mode, messages from different origin ports are added to a bag in ascending model ID order
+         * of their origin models (messages from ports of the same model keep the coupling definition order).
+         * Furthermore, each thread buffers its log entries, and they are forwarded to the logger after every
+         * simulation step in ascending model ID order. Output messages are logged before the new state of the model.
+         * As a result, the logs are exactly the same as those of a sequential simulation of the flattened model.
+         * The mode applies to all the simulate methods. In simulateClusters, clusters do not share the simulation time,
+         * so log entries are only forwarded to the logger at the end of the simulation.
+         * NOTE: once the deterministic mode is enabled, ICs remain in canonical order even if it is disabled again.
+         * @param enabled if true, the deterministic mode is enabled.
+         */
+        void setDeterministic(bool enabled) {
+            deterministic = enabled;
+            if (deterministic) {
+                // Child simulators get consecutive model IDs, so their index already follows the model ID order
+                const auto& subcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents();
+                std::unordered_map<const Component*, std::size_t> indices;
+                for (std::size_t i = 0; i < subcomponents.size(); ++i) {
+                    indices[subcomponents[i]->getComponent().get()] = i;
+                }
+                for (auto& [portTo, portsFrom]: stackedIC) {
+                    std::stable_sort(portsFrom.begin(), portsFrom.end(), [&indices](const auto& a, const auto& b) {
+                        return indices.at(a->getParent()) < indices.at(b->getParent());
+                    });
+                }
+            }
+        }
+
+        /**
+         * It sets the affinity map of the threads. Threads are pinned to their CPU at the beginning of every simulation.
+         * On NUMA systems, threads should be pinned before calling the relocate method, and the OpenMP runtime
+         * must not migrate them afterwards (e.g., OMP_PROC_BIND=true) if no affinity map is provided.
+         * @param cpus CPU of every thread. If empty, threads are not pinned.
+         * @throw CadmiumSimulationException if thread affinity is not supported or any CPU index is invalid.
+         */
+        void setAffinity(std::vector<int> cpus) {
+#ifdef __linux__
+            for (auto cpu: cpus) {
+                if (cpu < 0 || cpu >= CPU_SETSIZE) {
+                    throw CadmiumSimulationException("invalid CPU index");
+                }
+            }
+            affinity = std::move(cpus);
+#else
+            if (!cpus.empty()) {
+                throw CadmiumSimulationException("thread affinity is not supported in this platform");
+            }
+#endif
+        }
+
+        //! @return the affinity map of the threads.
+        [[nodiscard]] const std::vector<int>& getAffinity() const {
+            return affinity;
+        }
+
+        /**
+         * It re-allocates every child simulator and the state of its atomic model from the thread that executes it.
+         * As operating systems place memory pages on the NUMA node of the thread that touches them first,
+         * each thread ends up working with node-local memory. Subcomponents are distributed among threads with the
+         * same static schedule as the simulate methods, so it must be called with the same number of threads.
+         * @param thread_number number of threads to be used in the simulation.
+         */
+        void relocate(unsigned int thread_number = std::thread::hardware_concurrency()) {
+            auto topCoordinator = rootCoordinator->getTopCoordinator();
+            long nBatches = batches.size();
+			#pragma omp parallel default(none) num_threads(thread_number) shared(topCoordinator, nBatches)
+            {
+                pinThread(omp_get_thread_num());
+				#pragma omp for schedule(static)
+                for (long b = 0; b < nBatches; b++) {
+                    for (auto k = batches[b].first; k < batches[b].last; ++k) {
+                        topCoordinator->relocateSubcomponent(typeOrder[k]);
+                    }
+                }
+            }
+            updateGroupedSimulators();
+        }
+
+        /**
+         * It sets a fixed serial threshold. When a step of the simulate(timeInterval) method activates fewer models than
+         * the threshold, the following steps are run by a single thread (i.e., without barriers) until the activity
+         * reaches the threshold again. By default, the threshold is 0 (i.e., all the steps are run in parallel).
+         * @param threshold minimum number of active models for running a simulation step in parallel.
+         */
+        void setSerialThreshold(std::size_t threshold) {
+            serialThreshold = threshold;
+            adaptiveThreshold = false;
+        }
+
+        /**
+         * It enables or disables the adaptive serial threshold. The threshold is then learned during the simulation
+         * from the execution time of parallel steps and the execution time per active model of serial steps.
+         * @param enabled if true, the serial threshold is learned during the simulation.
+         */
+        void setAdaptiveSerialThreshold(bool enabled) {
+            adaptiveThreshold = enabled;
+            parallelStepTime = 0;
+            serialActivationTime = 0;
+        }
+
+        /**
+         * @return current serial threshold. With an adaptive threshold, it returns the threshold learned so far.
+         */
+        [[nodiscard]] std::size_t getSerialThreshold() const {
+            if (adaptiveThreshold) {
+                return (serialActivationTime == 0) ? std::numeric_limits<std::size_t>::max() :
+                    static_cast<std::size_t>(std::ceil(parallelStepTime / serialActivationTime));
+            }
+            return serialThreshold;
+        }
+
+        //! @return true if the deterministic mode is enabled.
+        [[nodiscard]] bool isDeterministic() const {
+            return deterministic;
+        }
+
+        /**
+         * It enables or disables zero-time cascades in the simulate(timeInterval) method. When a simulation step leaves
+         * models imminent at the same simulation time (e.g., models with a time advance of zero after receiving
+         * a message), the following steps are run by a single thread as micro-steps. Each micro-step only visits the
+         * models that triggered a state transition in the previous micro-step and the receivers of their messages,
+         * without barriers or scans of the next time array. Results are the same as with regular steps.
+         * Zero-time chains are run sequentially, so they pay off when they only activate a few models at a time.
+         * By default, zero-time cascades are disabled.
+         * @param enabled if true, zero-time cascades are enabled.
+         */
+        void setZeroTimeCascade(bool enabled) {
+            zeroTimeCascade = enabled;
+        }
+
+        //! @return true if zero-time cascades are enabled.
+        [[nodiscard]] bool isZeroTimeCascade() const {
+            return zeroTimeCascade;
+        }
+
         void start() {
 			rootCoordinator->start();
 		}
@@ -52,28 +562,38 @@ namespace cadmium {
 		}
 
         void simulate(long nIterations, unsigned int thread_number = std::thread::hardware_concurrency()) {
-            // First, we make sure that Mutexes are activated
-            if (rootCoordinator->getLogger()) {
-            	rootCoordinator->getLogger()->createMutex();
+            auto logger = rootCoordinator->getLogger();
+            // First, we make sure that Mutexes are activated (only when threads share the logger)
+            if (logger) {
+                (deterministic) ? logger->removeMutex() : logger->createMutex();
             }
             double timeNext = rootCoordinator->getTopCoordinator()->getTimeNext();
+            std::vector<std::vector<DeferredLog>> logBuffers(thread_number);
+            std::vector<double> timeBuffer;
+            auto timeNexts = alignedTimes(timeBuffer);
 
             // Threads created
-			#pragma omp parallel default(none) num_threads(thread_number) shared(timeNext, nIterations)
+			#pragma omp parallel default(none) num_threads(thread_number) shared(timeNext, nIterations, logger, logBuffers, timeNexts)
             {
                 //each thread get its if within the group
                 size_t tid = omp_get_thread_num();
+                pinThread(tid);
 
                 auto subcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents();
-                auto nSubcomponents = subcomponents.size();
+                long nSubcomponents = subcomponents.size();
                 auto nICs = stackedIC.size();
-                double localNext;
+                long nBatches = batches.size();
+                bool deferLogs = deterministic && logger != nullptr;
+                if (deferLogs) {
+                    setDeferredLoggers(logBuffers[tid]);
+                }
 
                 while (nIterations-- > 0 && timeNext < std::numeric_limits<double>::infinity()) {
                     // Step 1: execute output functions
 					#pragma omp for schedule(static)
-                    for (long i = 0; i < nSubcomponents; i++) {
-                        subcomponents.at(i)->collection(timeNext);
+                    for (long b = 0; b < nBatches; b++) {
+                        const auto& batch = batches[b];
+                        batch.collection(&grouped[batch.first], batch.last - batch.first, timeNext, timeNexts + batch.first);
                     }
 					#pragma omp barrier
                     //end Step 1
@@ -90,66 +610,102 @@ namespace cadmium {
 
                     // Step 3: state transitions
 					#pragma omp for schedule(static)
-                    for (long i = 0; i < nSubcomponents; i++) {
-                        subcomponents.at(i)->transition(timeNext);
-                        subcomponents.at(i)->clear();
+                    for (long b = 0; b < nBatches; b++) {
+                        const auto& batch = batches[b];
+                        batch.transition(&grouped[batch.first], batch.last - batch.first, timeNext, timeNexts + batch.first);
                     }
 					#pragma omp barrier
                     // end Step 3
 
                     // Step 4: time for next events
-                    localNext = subcomponents[0]->getTimeNext();  // Potential bug: what if model is empty? I'd initialize this to infinity and iterate from 0
-					#pragma omp for schedule(static)
-                    for (long i = 1; i < nSubcomponents; i++){
-                        if (subcomponents[i]->getTimeNext() < localNext) {
-                            localNext = subcomponents[i]->getTimeNext();
-                        }
-                    }
 					#pragma omp single
                     {
-                        timeNext = localNext;
-                    }
-					#pragma omp barrier
-					#pragma omp critical
-                    {
-                        if (localNext < timeNext) {
-                            timeNext = localNext;
+                        timeNext = std::numeric_limits<double>::infinity();
+                        // All the state transitions are over, so the logs of this step can be forwarded
+                        if (deferLogs) {
+                            commitDeferredLogs(logger, logBuffers, subcomponents);
                         }
                     }
-					#pragma omp barrier
+                    // Next times are contiguous in memory, so the reduction is a SIMD scan over doubles
+					#pragma omp for simd schedule(simd: static) reduction(min: timeNext)
+                    for (long i = 0; i < nSubcomponents; i++) {
+                        timeNext = std::min(timeNext, timeNexts[i]);
+                    }
                     //end Step 4
 
                 }//end simulation loop
             }
+            if (deterministic && logger != nullptr) {
+                rootCoordinator->setLogger(logger);
+            }
         }
 
         void simulate(double timeInterval, unsigned int thread_number = std::thread::hardware_concurrency()) {
             // error: only a variable or static member can be used in a data sharing clause
             auto rootCoordinator = this->rootCoordinator;
+            auto logger = rootCoordinator->getLogger();
 
-            // First, we make sure that Mutexes are activated
-            if (rootCoordinator->getLogger()) {
-            	rootCoordinator->getLogger()->createMutex();
+            // First, we make sure that Mutexes are activated (only when threads share the logger)
+            if (logger) {
+                (deterministic) ? logger->removeMutex() : logger->createMutex();
             }
         	double timeNext = rootCoordinator->getTopCoordinator()->getTimeNext();
             double timeFinal = rootCoordinator->getTopCoordinator()->getTimeLast()+timeInterval;
+            std::vector<std::vector<DeferredLog>> logBuffers(thread_number);
+            std::vector<double> timeBuffer;
+            auto timeNexts = alignedTimes(timeBuffer);
+            // Buffers for serial steps. The first step is always run in parallel, as next times are not stored yet
+            std::vector<std::size_t> active;
+            std::vector<char> marked(grouped.size());
+            bool serial = false;
+            std::size_t activity = 0;
+            double stamp = omp_get_wtime();
+            double timeStep = timeNext;  // Time of the last parallel step (for detecting zero-time chains)
 
             //threads created
-			#pragma omp parallel default(none) num_threads(thread_number) shared(timeNext, timeFinal, rootCoordinator)
+			#pragma omp parallel default(none) num_threads(thread_number) shared(timeNext, timeFinal, rootCoordinator, logger, logBuffers, timeNexts, active, marked, serial, activity, stamp, timeStep)
             {
                 //each thread get its if within the group
                 size_t tid = omp_get_thread_num();
+                pinThread(tid);
 
                 auto& subcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents();
-                auto nSubcomponents = subcomponents.size();
+                long nSubcomponents = subcomponents.size();
                 auto nICs = stackedIC.size();
-                double localNext;
+                long nBatches = batches.size();
+                bool deferLogs = deterministic && logger != nullptr;
+                if (deferLogs) {
+                    setDeferredLoggers(logBuffers[tid]);
+                }
 
                 while(timeNext < timeFinal) {
+                    // Low activity: one thread runs the steps until activity grows, while the others wait
+                    if (serial) {
+                        // All the threads must check the loop conditions before the single thread modifies them
+						#pragma omp barrier
+						#pragma omp single
+                        {
+                            while (serial && timeNext < timeFinal) {
+                                activity = serialStep(timeNext, timeNexts, active, marked);
+                                if (deferLogs) {
+                                    commitDeferredLogs(logger, logBuffers, subcomponents);
+                                }
+                                auto now = omp_get_wtime();
+                                updateTime(serialActivationTime, (now - stamp) / (double) std::max<std::size_t>(activity, 1));
+                                stamp = now;
+                                serial = runSerial(activity);
+                                timeNext = *std::min_element(timeNexts, timeNexts + nSubcomponents);
+                            }
+                            activity = 0;
+                        }
+                        continue;
+                    }
+
                     // Step 1: execute output functions
 					#pragma omp for schedule(static)
-                    for (long i = 0; i < nSubcomponents; i++) {
-                    	subcomponents.at(i)->collection(timeNext);
+                    for (long b = 0; b < nBatches; b++) {
+                        const auto& batch = batches[b];
+                        batch.collection(&grouped[batch.first], batch.last - batch.first, timeNext, timeNexts + batch.first);
                     }
 					#pragma omp barrier
                     //end Step 1
@@ -165,111 +721,327 @@ namespace cadmium {
                     // end Step 2
 
                     // Step 3: state transitions
-					#pragma omp for schedule(static)
-                    for (long i = 0; i < nSubcomponents; i++){
-                        subcomponents.at(i)->transition(timeNext);
-                        subcomponents.at(i)->clear();
+					#pragma omp for schedule(static) reduction(+: activity)
+                    for (long b = 0; b < nBatches; b++) {
+                        const auto& batch = batches[b];
+                        activity += batch.transition(&grouped[batch.first], batch.last - batch.first, timeNext, timeNexts + batch.first);
                     }
 					#pragma omp barrier
                     // end Step 3
 
                     // Step 4: time for next events
-                    localNext = subcomponents[0]->getTimeNext();
-					#pragma omp for schedule(static)
-                    for (long i = 1; i < nSubcomponents; i++){
-                        if (subcomponents[i]->getTimeNext() < localNext){
-                            localNext = subcomponents[i]->getTimeNext();
-                        }
-                    }
 					#pragma omp single
                     {
-                        timeNext = localNext;
-                    }
-					#pragma omp barrier
-					#pragma omp critical
-                    {
-                        if (localNext < timeNext) {
-                            timeNext = localNext;
+                        timeStep = timeNext;
+                        timeNext = std::numeric_limits<double>::infinity();
+                        // All the state transitions are over, so the logs of this step can be forwarded
+                        if (deferLogs) {
+                            commitDeferredLogs(logger, logBuffers, subcomponents);
                         }
+                        auto now = omp_get_wtime();
+                        updateTime(parallelStepTime, now - stamp);
+                        stamp = now;
+                        serial = runSerial(activity);
+                        activity = 0;
+                    }
+                    // Next times are contiguous in memory, so the reduction is a SIMD scan over doubles
+					#pragma omp for simd schedule(simd: static) reduction(min: timeNext)
+                    for (long i = 0; i < nSubcomponents; i++) {
+                        timeNext = std::min(timeNext, timeNexts[i]);
                     }
-					#pragma omp barrier
                     //end Step 4
 
+                    // Zero-time chain: one thread runs the following steps as micro-steps, while the others wait
+                    if (zeroTimeCascade && timeNext == timeStep) {
+                        // All the threads must check the condition before the single thread modifies the next time
+						#pragma omp barrier
+						#pragma omp single
+                        {
+                            serialStep(timeNext, timeNexts, active, marked);
+                            if (deferLogs) {
+                                commitDeferredLogs(logger, logBuffers, subcomponents);
+                            }
+                            stamp = omp_get_wtime();
+                            timeNext = *std::min_element(timeNexts, timeNexts + nSubcomponents);
+                        }
+                    }
+
                 }//end simulation loop
             }
+            if (deterministic && logger != nullptr) {
+                rootCoordinator->setLogger(logger);
+            }
         }
 
         void simulateSerialCollection(double timeInterval, unsigned int thread_number = std::thread::hardware_concurrency()) {
             // error: only a variable or static member can be used in a data sharing clause
             auto rootCoordinator = this->rootCoordinator;
 
-            // Firsts, we make sure that Mutexes are activated
-            if(rootCoordinator->getLogger()) {
-            	rootCoordinator->getLogger()->createMutex();
+            auto logger = rootCoordinator->getLogger();
+
+            // First, we make sure that Mutexes are activated (only when threads share the logger)
+            if (logger) {
+                (deterministic) ? logger->removeMutex() : logger->createMutex();
             }
         	double timeNext = rootCoordinator->getTopCoordinator()->getTimeNext();
             double timeFinal = rootCoordinator->getTopCoordinator()->getTimeLast() + timeInterval;
+            std::vector<std::vector<DeferredLog>> logBuffers(thread_number);
+            std::vector<double> timeBuffer;
+            auto timeNexts = alignedTimes(timeBuffer);
 
             //threads created
-			#pragma omp parallel default(none) num_threads(thread_number) shared(timeNext, timeFinal, rootCoordinator)
+			#pragma omp parallel default(none) num_threads(thread_number) shared(timeNext, timeFinal, rootCoordinator, logger, logBuffers, timeNexts)
             {
                 //each thread get its if within the group
                 size_t tid = omp_get_thread_num();
+                pinThread(tid);
 
                 auto& subcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents();
-                auto nSubcomponents = subcomponents.size();
+                long nSubcomponents = subcomponents.size();
                 auto nICs = stackedIC.size();
-                double localNext;
+                long nBatches = batches.size();
+                bool deferLogs = deterministic && logger != nullptr;
+                if (deferLogs) {
+                    setDeferredLoggers(logBuffers[tid]);
+                }
 
                 while (timeNext < timeFinal) {
                     // Step 1: execute output functions
 					#pragma omp for schedule(static)
-                    for (long i = 0; i < nSubcomponents; i++){
-                    	subcomponents.at(i)->collection(timeNext);
+                    for (long b = 0; b < nBatches; b++) {
+                        const auto& batch = batches[b];
+                        batch.collection(&grouped[batch.first], batch.last - batch.first, timeNext, timeNexts + batch.first);
                     }
 					#pragma omp barrier
                     //end Step 1
 
                     // Step 2: route messages (in sequential)
-                    for (const auto& [portTo, portsFrom]: stackedIC) {
-                        for (const auto& portFrom: portsFrom) {
-                            portTo->propagate(portFrom);
+					#pragma omp single
+                    {
+                        for (const auto& [portTo, portsFrom]: stackedIC) {
+                            for (const auto& portFrom: portsFrom) {
+                                portTo->propagate(portFrom);
+                            }
                         }
                     }
                     // end Step 2
 
                     // Step 3: state transitions
 					#pragma omp for schedule(static)
-                    for (long i = 0; i < nSubcomponents; i++) {
-                        subcomponents.at(i)->transition(timeNext);
-                        subcomponents.at(i)->clear();
+                    for (long b = 0; b < nBatches; b++) {
+                        const auto& batch = batches[b];
+                        batch.transition(&grouped[batch.first], batch.last - batch.first, timeNext, timeNexts + batch.first);
                     }
 					#pragma omp barrier
                     // end Step 3
 
                     // Step 4: time for next events
-                    localNext = subcomponents[0]->getTimeNext();
-					#pragma omp for schedule(static)
-                    for (long i = 1; i < nSubcomponents; i++){
-                        if (subcomponents[i]->getTimeNext() < localNext) {
-                            localNext = subcomponents[i]->getTimeNext();
-                        }
-                    }
 					#pragma omp single
                     {
-                        timeNext = localNext;
+                        timeNext = std::numeric_limits<double>::infinity();
+                        // All the state transitions are over, so the logs of this step can be forwarded
+                        if (deferLogs) {
+                            commitDeferredLogs(logger, logBuffers, subcomponents);
+                        }
+                    }
+                    // Next times are contiguous in memory, so the reduction is a SIMD scan over doubles
+					#pragma omp for simd schedule(simd: static) reduction(min: timeNext)
+                    for (long i = 0; i < nSubcomponents; i++) {
+                        timeNext = std::min(timeNext, timeNexts[i]);
+                    }
+                    //end Step 4
+
+                }//end simulation loop
+            }
+            if (deterministic && logger != nullptr) {
+                rootCoordinator->setLogger(logger);
+            }
+        }
+
+        /**
+         * It runs the simulation delivering messages as soon as they are produced.
+         * Right after the output function of an atomic model, the producing thread pushes its non-empty output ports
+         * to per-thread outboxes grouped by the thread that owns the destination model. Then, each thread merges the
+         * outboxes addressed to it just before triggering the state transitions of its models. In this way,
+         * only couplings whose origin model fired are visited, and there is no separate message routing phase.
+         * Chunks are contiguous, so bags already receive messages in ascending model ID order of their origin models.
+         * @param timeInterval total simulation time.
+         * @param thread_number number of threads to be used.
+         */
+        void simulatePushRouting(double timeInterval, unsigned int thread_number = std::thread::hardware_concurrency()) {
+            // error: only a variable or static member can be used in a data sharing clause
+            auto rootCoordinator = this->rootCoordinator;
+            auto logger = rootCoordinator->getLogger();
+
+            // First, we make sure that Mutexes are activated (only when threads share the logger)
+            if (logger) {
+                (deterministic) ? logger->removeMutex() : logger->createMutex();
+            }
+            double timeFinal = rootCoordinator->getTopCoordinator()->getTimeLast() + timeInterval;
+            double timeStart = rootCoordinator->getTopCoordinator()->getTimeNext();
+            std::vector<std::vector<DeferredLog>> logBuffers(thread_number);
+            // Partial next times are double-buffered, so we can reset one of them while the other is being reduced
+            double partialNext[2] = {std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity()};
+            // outbox[i][j] contains the couplings with messages produced by thread i that thread j must propagate
+            std::vector<std::vector<std::vector<const IndexedCoupling*>>> outbox;
+
+            //threads created
+			#pragma omp parallel default(none) num_threads(thread_number) shared(timeStart, partialNext, timeFinal, rootCoordinator, logger, logBuffers, outbox)
+            {
+                //each thread get its if within the group
+                size_t tid = omp_get_thread_num();
+                pinThread(tid);
+                size_t nThreads = omp_get_num_threads();
+
+                auto& subcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents();
+                auto nSubcomponents = subcomponents.size();
+                // Each thread always works with the same contiguous chunk of subcomponents
+                auto first = nSubcomponents * tid / nThreads;
+                auto last = nSubcomponents * (tid + 1) / nThreads;
+                auto owner = [nSubcomponents, nThreads](std::size_t i) {
+                    return ((i + 1) * nThreads - 1) / nSubcomponents;
+                };
+				#pragma omp single
+                {
+                    outbox.resize(nThreads, std::vector<std::vector<const IndexedCoupling*>>(nThreads));
+                }
+                bool deferLogs = deterministic && logger != nullptr;
+                if (deferLogs) {
+                    auto deferredLogger = std::make_shared<DeferredLogger>(logBuffers[tid]);
+                    for (auto i = first; i < last; ++i) {
+                        subcomponents[i]->setLogger(deferredLogger);
+                    }
+                }
+                double timeNext = timeStart;
+                std::size_t step = 0;
+
+                while (timeNext < timeFinal) {
+                    // Step 1: execute output functions and push messages to the outboxes
+                    for (auto i = first; i < last; ++i) {
+                        // Output ports are cleared here, as other threads read them until the previous step is over
+                        for (const auto& port: subcomponents[i]->getComponent()->getOutPorts()) {
+                            port->clear();
+                        }
+                        if (subcomponents[i]->getTimeNext() <= timeNext) {
+                            subcomponents[i]->collection(timeNext);
+                            for (const auto& coupling: outgoingIC[i]) {
+                                if (!std::get<0>(coupling)->empty()) {
+                                    outbox[tid][owner(std::get<2>(coupling))].push_back(&coupling);
+                                }
+                            }
+                        }
                     }
 					#pragma omp barrier
+                    //end Step 1
+
+                    // Step 2: merge incoming messages, state transitions, and time for next events
+                    if (tid == 0) {
+                        partialNext[(step + 1) % 2] = std::numeric_limits<double>::infinity();
+                    }
+                    for (auto& box: outbox) {
+                        for (const auto& coupling: box[tid]) {
+                            std::get<1>(*coupling)->propagate(std::get<0>(*coupling));
+                        }
+                        box[tid].clear();
+                    }
+                    double localNext = std::numeric_limits<double>::infinity();
+                    for (auto i = first; i < last; ++i) {
+                        subcomponents[i]->transition(timeNext);
+                        for (const auto& port: subcomponents[i]->getComponent()->getInPorts()) {
+                            port->clear();
+                        }
+                        localNext = std::min(localNext, subcomponents[i]->getTimeNext());
+                    }
 					#pragma omp critical
                     {
-                        if (localNext < timeNext) {
-                            timeNext = localNext;
-                        }
+                        partialNext[step % 2] = std::min(partialNext[step % 2], localNext);
                     }
 					#pragma omp barrier
-                    //end Step 4
+                    timeNext = partialNext[step++ % 2];
+                    //end Step 2
 
+                    // All the state transitions are over, so the logs of this step can be forwarded
+                    if (deferLogs) {
+						#pragma omp single
+                        {
+                            commitDeferredLogs(logger, logBuffers, subcomponents);
+                        }
+                    }
                 }//end simulation loop
+
+                for (auto i = first; i < last; ++i) {
+                    subcomponents[i]->clear();
+                }
+            }
+            if (deterministic && logger != nullptr) {
+                rootCoordinator->setLogger(logger);
+            }
+        }
+
+        /**
+         * It runs the simulation of every weakly connected cluster of subcomponents with its own event loop.
+         * As clusters never exchange messages, they do not need to share the simulation time. Clusters are
+         * distributed dynamically among threads, and there is no synchronization between them.
+         * NOTE: as clusters advance independently, the logger receives the log entries of different clusters
+         * interleaved in any order, and Logger::logTime is not called. In deterministic mode, threads buffer
+         * their log entries instead, and they are forwarded to the logger in order at the end of the simulation.
+         * @param timeInterval total simulation time.
+         * @param thread_number number of threads to be used.
+         */
+        void simulateClusters(double timeInterval, unsigned int thread_number = std::thread::hardware_concurrency()) {
+            // error: only a variable or static member can be used in a data sharing clause
+            auto rootCoordinator = this->rootCoordinator;
+            auto logger = rootCoordinator->getLogger();
+
+            // First, we make sure that Mutexes are activated (only when threads share the logger)
+            if (logger) {
+                (deterministic) ? logger->removeMutex() : logger->createMutex();
+            }
+            double timeFinal = rootCoordinator->getTopCoordinator()->getTimeLast() + timeInterval;
+            auto& subcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents();
+            long nClusters = clusters.size();
+            bool deferLogs = deterministic && logger != nullptr;
+            std::vector<std::vector<DeferredLog>> logBuffers(thread_number);
+
+			#pragma omp parallel for default(none) num_threads(thread_number) schedule(dynamic) shared(timeFinal, subcomponents, nClusters, deferLogs, logBuffers)
+            for (long c = 0; c < nClusters; ++c) {
+                auto tid = omp_get_thread_num();
+                pinThread(tid);
+                const auto& cluster = clusters[c];
+                if (deferLogs) {
+                    // Clusters are scheduled dynamically, so they log to the buffer of the thread that runs them
+                    auto deferredLogger = std::make_shared<DeferredLogger>(logBuffers[tid]);
+                    for (auto i: cluster) {
+                        subcomponents[i]->setLogger(deferredLogger);
+                    }
+                }
+                double timeNext = std::numeric_limits<double>::infinity();
+                for (auto i: cluster) {
+                    timeNext = std::min(timeNext, subcomponents[i]->getTimeNext());
+                }
+                while (timeNext < timeFinal) {
+                    // Step 1: execute output functions and route messages of imminent subcomponents
+                    for (auto i: cluster) {
+                        if (subcomponents[i]->getTimeNext() <= timeNext) {
+                            subcomponents[i]->collection(timeNext);
+                            for (const auto& coupling: outgoingIC[i]) {
+                                std::get<1>(coupling)->propagate(std::get<0>(coupling));
+                            }
+                        }
+                    }
+                    // Step 2: state transitions and time for next events
+                    double nextNext = std::numeric_limits<double>::infinity();
+                    for (auto i: cluster) {
+                        subcomponents[i]->transition(timeNext);
+                        subcomponents[i]->clear();
+                        nextNext = std::min(nextNext, subcomponents[i]->getTimeNext());
+                    }
+                    timeNext = nextNext;
+                }
+            }
+            if (deferLogs) {
+                commitDeferredLogs(logger, logBuffers, subcomponents);
+                rootCoordinator->setLogger(logger);
             }
         }
     };
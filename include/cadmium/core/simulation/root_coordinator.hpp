@@ -18,16 +18,20 @@
 #include "../logger/logger.hpp"
 
 namespace cadmium {
-	//! Root coordinator class.
-    class RootCoordinator {
+	/**
+	 * @brief Root coordinator class.
+	 * @tparam T the data type used for representing the simulation time.
+	 */
+	template <typename T>
+    class BasicRootCoordinator {
      protected:
-        std::shared_ptr<Coordinator> topCoordinator;  //!< Pointer to top coordinator.
-		std::shared_ptr<Logger> logger;               //!< Pointer to simulation logger.
+        std::shared_ptr<BasicCoordinator<T>> topCoordinator;  //!< Pointer to top coordinator.
+		std::shared_ptr<Logger> logger;                       //!< Pointer to simulation logger.
 
-		void simulationAdvance(double timeNext) {
+		void simulationAdvance(T timeNext) {
 			if (logger != nullptr) {
 				logger->lock();  // TODO are locks necessary here? In theory, you should be the only one executing here
-				logger->logTime(timeNext);
+				logger->logTime(TimeTraits<T>::toDouble(timeNext));
 				logger->unlock();
 			}
 			topCoordinator->collection(timeNext);
@@ -36,9 +40,9 @@ namespace cadmium {
 		}
 
      public:
-        RootCoordinator(std::shared_ptr<Coupled> model, double time):
-			topCoordinator(std::make_shared<Coordinator>(std::move(model), time)), logger() {}
-		explicit RootCoordinator(std::shared_ptr<Coupled> model): RootCoordinator(std::move(model), 0) {}
+        BasicRootCoordinator(std::shared_ptr<Coupled> model, T time):
+			topCoordinator(std::make_shared<BasicCoordinator<T>>(std::move(model), time)), logger() {}
+		explicit BasicRootCoordinator(std::shared_ptr<Coupled> model): BasicRootCoordinator(std::move(model), TimeTraits<T>::zero()) {}
 
         void setLogger(const std::shared_ptr<Logger>& log) {
 			logger = log;
@@ -49,7 +53,7 @@ namespace cadmium {
         	return logger;
         }
 
-        std::shared_ptr<Coordinator> getTopCoordinator() {
+        std::shared_ptr<BasicCoordinator<T>> getTopCoordinator() {
 			return topCoordinator;
 		}
 
@@ -73,26 +77,29 @@ namespace cadmium {
             if (logger != nullptr) {
                 logger->removeMutex();
             }
-			double timeNext = topCoordinator->getTimeNext();
-            while (nIterations-- > 0 && timeNext < std::numeric_limits<double>::infinity()) {
+			T timeNext = topCoordinator->getTimeNext();
+            while (nIterations-- > 0 && timeNext < TimeTraits<T>::infinity()) {
 				simulationAdvance(timeNext);
                 timeNext = topCoordinator->getTimeNext();
             }
         }
 
-		[[maybe_unused]] void simulate(double timeInterval) {
+		[[maybe_unused]] void simulate(T timeInterval) {
             // Firsts, we make sure that Mutexes are not activated
             if (logger != nullptr) {
                 logger->removeMutex();
             }
-			double timeNext = topCoordinator->getTimeNext();
-			double timeFinal = topCoordinator->getTimeLast()+timeInterval;
+			T timeNext = topCoordinator->getTimeNext();
+			T timeFinal = topCoordinator->getTimeLast()+timeInterval;
             while(timeNext < timeFinal) {
 				simulationAdvance(timeNext);
                 timeNext = topCoordinator->getTimeNext();
             }
         }
     };
+
+	//! Root coordinator class for models that represent the simulation time with doubles.
+	using RootCoordinator = BasicRootCoordinator<double>;
 }
 
 #endif //CADMIUM_CORE_SIMULATION_ROOT_COORDINATOR_HPP_
@@ -11,6 +11,7 @@
 #define CADMIUM_CORE_SIMULATION_SIMULATOR_HPP_
 
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include "abs_simulator.hpp"
 #include "../exception.hpp"
@@ -18,18 +19,27 @@
 #include "../modeling/atomic.hpp"
 
 namespace cadmium {
-    //! DEVS simulator.
-    class Simulator: public AbstractSimulator {
+    /**
+     * @brief DEVS simulator.
+     *
+     * Loggers work with doubles, so the simulator converts the simulation time before logging.
+     * @tparam T the data type used for representing the simulation time.
+     */
+    template <typename T>
+    class BasicSimulator: public BasicAbstractSimulator<T> {
      private:
-        std::shared_ptr<AtomicInterface> model;  //!< Pointer to the corresponding atomic DEVS model.
-        std::shared_ptr<Logger> logger;          //!< Pointer to logger (for output messages and state).
+        using BasicAbstractSimulator<T>::modelId;
+        using BasicAbstractSimulator<T>::timeLast;
+        using BasicAbstractSimulator<T>::timeNext;
+        std::shared_ptr<BasicAtomicInterface<T>> model;  //!< Pointer to the corresponding atomic DEVS model.
+        std::shared_ptr<Logger> logger;                  //!< Pointer to logger (for output messages and state).
      public:
         /**
          * Constructor function.
          * @param model pointer to the atomic model.
          * @param time initial simulation time.
          */
-        Simulator(std::shared_ptr<AtomicInterface> model, double time): AbstractSimulator(time), model(std::move(model)), logger() {
+        BasicSimulator(std::shared_ptr<BasicAtomicInterface<T>> model, T time): BasicAbstractSimulator<T>(time), model(std::move(model)), logger() {
             if (this->model == nullptr) {
                 throw CadmiumSimulationException("no atomic model provided");
             }
@@ -63,11 +73,11 @@ namespace cadmium {
          * It performs all the operations before running a simulation.
          * @param time initial simulation time.
          */
-        void start(double time) override {
+        void start(T time) override {
             timeLast = time;
             if (logger != nullptr) {
                 logger->lock();
-                logger->logState(timeLast, modelId, model->getId(), model->logState());
+                logger->logState(TimeTraits<T>::toDouble(timeLast), modelId, model->getId(), model->logState());
                 logger->unlock();
             }
         };
@@ -76,11 +86,11 @@ namespace cadmium {
          * It performs all the operations after running a simulation.
          * @param time final simulation time.
          */
-        void stop(double time) override {
+        void stop(T time) override {
             timeLast = time;
             if (logger != nullptr) {
                 logger->lock();
-                logger->logState(timeLast, modelId, model->getId(), model->logState());
+                logger->logState(TimeTraits<T>::toDouble(timeLast), modelId, model->getId(), model->logState());
                 logger->unlock();
             }
         }
@@ -89,41 +99,66 @@ namespace cadmium {
          * It calls to the output function of the atomic model.
          * @param time current simulation time.
          */
-        void collection(double time) override {
+        void collection(T time) override {
+            collection<BasicAtomicInterface<T>>(time);
+        }
+
+        /**
+         * It calls to the corresponding state transition function.
+         * @param time current simulation time.
+         */
+        void transition(T time) override {
+            transition<BasicAtomicInterface<T>>(time);
+        }
+
+        /**
+         * It calls to the output function of an atomic model of a known type.
+         * As M is final, the compiler calls the functions of the model without virtual dispatch.
+         * @tparam M dynamic type of the atomic model. It must be final or BasicAtomicInterface<T> (i.e., virtual dispatch).
+         * @param time current simulation time.
+         */
+        template <typename M>
+        void collection(T time) {
+            static_assert(std::is_same_v<M, BasicAtomicInterface<T>> || std::is_final_v<M>, "atomic model type must be final");
             if (time >= timeNext) {
-                model->output();
+                static_cast<M&>(*model).output();
             }
         }
 
         /**
-         * It calls to the corresponding state transition function.
+         * It calls to the corresponding state transition function of an atomic model of a known type.
+         * As M is final, the compiler calls the functions of the model without virtual dispatch.
+         * @tparam M dynamic type of the atomic model. It must be final or BasicAtomicInterface<T> (i.e., virtual dispatch).
          * @param time current simulation time.
          */
-        void transition(double time) override {
-            auto inEmpty = model->inEmpty();
+        template <typename M>
+        void transition(T time) {
+            static_assert(std::is_same_v<M, BasicAtomicInterface<T>> || std::is_final_v<M>, "atomic model type must be final");
+            auto& atomic = static_cast<M&>(*model);
+            auto inEmpty = atomic.inEmpty();
             if (inEmpty && time < timeNext) {
                 return;
             }
             if (inEmpty) {
-                model->internalTransition();
+                atomic.internalTransition();
             } else {
                 auto e = time - timeLast;
-                (time < timeNext) ? model->externalTransition(e) : model->confluentTransition(e);
+                (time < timeNext) ? atomic.externalTransition(e) : atomic.confluentTransition(e);
             }
             if (logger != nullptr) {
                 logger->lock();  // TODO leave lock/unlock calls only for parallel execution
                 if (time >= timeNext) {
-                    for (const auto& outPort: model->getOutPorts()) {
+                    for (const auto& outPort: atomic.getOutPorts()) {
                         for (std::size_t i = 0; i < outPort->size(); ++i) {
-                            logger->logOutput(time, modelId, model->getId(), outPort->getId(), outPort->logMessage(i));
+                            logger->logOutput(TimeTraits<T>::toDouble(time), modelId, atomic.getId(), outPort->getId(), outPort->logMessage(i));
                         }
                     }
                 }
-                logger->logState(time, modelId, model->getId(), model->logState());
+                logger->logState(TimeTraits<T>::toDouble(time), modelId, atomic.getId(), atomic.logState());
                 logger->unlock();  // TODO leave lock/unlock calls only for parallel execution
             }
             timeLast = time;
-            timeNext = time + model->timeAdvance();
+            timeNext = time + atomic.timeAdvance();
         }
 
         //! It clears all the ports of the model.
@@ -131,6 +166,9 @@ namespace cadmium {
             model->clearPorts();
         }
     };
+
+    //! DEVS simulator for models that represent the simulation time with doubles.
+    using Simulator = BasicSimulator<double>;
 }
 
 #endif //CADMIUM_CORE_SIMULATION_SIMULATOR_HPP_
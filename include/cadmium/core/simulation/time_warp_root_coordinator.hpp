@@ -0,0 +1,511 @@
+/**
+ * Optimistic (Time Warp) parallel root coordinator.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_SIMULATION_TIME_WARP_ROOT_COORDINATOR_HPP_
+#define CADMIUM_CORE_SIMULATION_TIME_WARP_ROOT_COORDINATOR_HPP_
+
+#include <algorithm>
+#include <any>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <omp.h>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "deferred_logs.hpp"
+#include "root_coordinator.hpp"
+#include "virtual_time.hpp"
+#include "../exception.hpp"
+#include "../logger/logger.hpp"
+#include "../modeling/atomic.hpp"
+#include "../modeling/coupled.hpp"
+
+namespace cadmium {
+    //! Message exchanged between logical processes of a Time Warp simulation.
+    struct TimeWarpMessage {
+        VirtualTime vt;                               //!< Virtual time of the event that produced the message.
+        std::size_t sender;                           //!< Index of the logical process that sent the message.
+        std::size_t receiver;                         //!< Index of the logical process that receives the message.
+        unsigned long seq;                            //!< Sequence number of the message within the sender.
+        bool anti;                                    //!< If true, it is an anti-message that cancels a previous message.
+        std::shared_ptr<PortInterface> portTo;        //!< Input port of the receiver model.
+        std::shared_ptr<const PortInterface> bag;     //!< Port with a copy of the messages. Anti-messages do not have bags.
+    };
+
+    /**
+     * Record of an event executed by a logical process. It contains everything needed for rolling it back.
+     * Events are split in two phases: collection (i.e., output function) and state transition.
+     */
+    struct TimeWarpEvent {
+        VirtualTime vt;                        //!< Virtual time of the event.
+        bool transition;                       //!< If true, it is a state transition. Otherwise, it is a collection.
+        bool collected;                        //!< It is true if the output function was already triggered before the event.
+        std::any state;                        //!< Copy of the model state before the event. Collections do not need it.
+        double timeLast;                       //!< Time of the last state transition before the event.
+        VirtualTime timeNext;                  //!< Virtual time of the next internal transition before the event.
+        std::vector<TimeWarpMessage> inputs;   //!< Input messages consumed by the event.
+        std::vector<TimeWarpMessage> outputs;  //!< Messages sent by the event.
+    };
+
+    //! Logical process of a Time Warp simulation. It wraps one atomic model.
+    struct TimeWarpLP {
+        std::shared_ptr<AtomicInterface> model;  //!< Pointer to the atomic model.
+        long modelId;                            //!< ID of the atomic model.
+        double timeLast;                         //!< Time of the last state transition.
+        VirtualTime timeNext;                    //!< Virtual time of the next internal transition.
+        bool collected;                          //!< It is true if the output function for timeNext was already triggered.
+        std::pair<VirtualTime, bool> key;        //!< Key of the next event in the schedule (see nextEvent).
+        unsigned long nextSeq;                   //!< Sequence number of the next message to be sent.
+        std::multimap<VirtualTime, TimeWarpMessage> pending;  //!< Input messages not processed yet.
+        std::deque<TimeWarpEvent> processed;                  //!< Events processed since the last GVT.
+        std::vector<DeferredLog> logs;                        //!< Uncommitted log entries.
+        std::exception_ptr error;                             //!< Exception thrown by a speculative event (if any).
+        std::pair<VirtualTime, bool> errorKey;                //!< Key of the event that threw the exception.
+        //! Outgoing couplings grouped by output port. Destinations are pairs <port_to, receiver>.
+        std::vector<std::pair<std::shared_ptr<PortInterface>, std::vector<std::pair<std::shared_ptr<PortInterface>, std::size_t>>>> outgoing;
+
+        TimeWarpLP(std::shared_ptr<AtomicInterface> model, long modelId, double timeLast, VirtualTime timeNext):
+            model(std::move(model)), modelId(modelId), timeLast(timeLast), timeNext(timeNext), collected(),
+            key(timeNext, false), nextSeq(), pending(), processed(), logs(), error(), errorKey(), outgoing() {}
+
+        /**
+         * It computes the key of the next event of the logical process. Keys are pairs <virtual time, phase>.
+         * The phase is false for collections and true for state transitions. In this way, all the output functions
+         * with a given virtual time are scheduled before the state transitions with the same virtual time.
+         * @return key of the next event of the logical process.
+         */
+        [[nodiscard]] std::pair<VirtualTime, bool> nextEvent() const {
+            if (!collected && timeNext != VirtualTime::infinity() && (pending.empty() || timeNext <= pending.begin()->first)) {
+                return {timeNext, false};
+            }
+            return {(pending.empty()) ? timeNext : std::min(timeNext, pending.begin()->first), true};
+        }
+    };
+
+    //! Inbox of a simulation thread. Other threads push messages to logical processes owned by the thread here.
+    struct TimeWarpInbox {
+        std::mutex mutex;                       //!< Mutex for pushing messages from other threads.
+        std::vector<TimeWarpMessage> messages;  //!< Messages received and not processed yet.
+    };
+
+    /**
+     * @brief Optimistic parallel root coordinator.
+     *
+     * It implements the Time Warp protocol. Every atomic model of the flattened model is a logical process (LP),
+     * and each thread owns a contiguous chunk of LPs. Threads execute the events of their LPs in virtual time order
+     * without waiting for the rest of threads. Before executing an event, LPs save a copy of their model state.
+     * When a message arrives with a virtual time earlier than (or equal to) the last event executed by the receiver,
+     * the receiver rolls back to that time, restores its state, and sends anti-messages to cancel the messages sent by
+     * the events it undid (i.e., aggressive cancellation). Output functions only depend on the state before the event.
+     * Thus, they are executed in a separate phase before the state transitions with the same virtual time, and
+     * stragglers with the same virtual time as an output function do not undo it. Periodically, threads synchronize to compute the
+     * global virtual time (GVT). Events older than the GVT are committed: their saved states are released
+     * (i.e., fossil collection) and their logs are forwarded to the logger in timestamp order.
+     *
+     * Exceptions thrown by the models are speculative too. The LP keeps the exception with the key of the failed event
+     * and stops executing events. If a straggler rolls the LP back past that event, the exception is discarded.
+     * Otherwise, the exception is rethrown once the GVT reaches the failed event and no other pending event may undo it.
+     *
+     * All the atomic models must support state saving (see AtomicInterface::saveState). Additionally,
+     * the state transition and output functions of the models MUST NOT have side effects, as they may be executed
+     * more than once. Output messages are shared between threads, so their copies must be thread-safe.
+     */
+    class TimeWarpRootCoordinator {
+     private:
+        std::shared_ptr<RootCoordinator> rootCoordinator;  //!< Root coordinator used for starting and stopping the simulation.
+        std::vector<TimeWarpLP> lps;                       //!< Logical processes of the simulation.
+        unsigned int gvtPeriod;                            //!< Maximum number of events executed by a thread between GVT computations.
+     public:
+        TimeWarpRootCoordinator(std::shared_ptr<Coupled> model, double time): gvtPeriod(1000) {
+            model->flatten();  // In parallel execution, models MUST be flat
+            rootCoordinator = std::make_shared<RootCoordinator>(model, time);
+            const auto& subcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents();
+            std::unordered_map<const Component*, std::size_t> indices;
+            for (const auto& simulator: subcomponents) {
+                auto atomic = std::dynamic_pointer_cast<AtomicInterface>(simulator->getComponent());
+                if (atomic == nullptr) {
+                    throw CadmiumSimulationException("Time Warp simulation requires a flat model");
+                }
+                [[maybe_unused]] auto saved = atomic->saveState();  // it throws an exception if state saving is not supported
+                indices[atomic.get()] = lps.size();
+                lps.emplace_back(atomic, 0, simulator->getTimeLast(), VirtualTime(simulator->getTimeNext(), 0));
+            }
+            std::unordered_map<const PortInterface*, std::size_t> outIndices;
+            for (const auto& [portFrom, portTo]: model->getSerialICs()) {
+                auto& lp = lps[indices.at(portFrom->getParent())];
+                if (outIndices.find(portFrom.get()) == outIndices.end()) {
+                    outIndices[portFrom.get()] = lp.outgoing.size();
+                    lp.outgoing.emplace_back(portFrom, std::vector<std::pair<std::shared_ptr<PortInterface>, std::size_t>>());
+                }
+                lp.outgoing[outIndices.at(portFrom.get())].second.emplace_back(portTo, indices.at(portTo->getParent()));
+            }
+        }
+        explicit TimeWarpRootCoordinator(std::shared_ptr<Coupled> model): TimeWarpRootCoordinator(std::move(model), 0) {}
+
+        void setLogger(const std::shared_ptr<Logger>& log) {
+            rootCoordinator->setLogger(log);
+        }
+
+        /**
+         * It sets the maximum number of events executed by each thread between GVT computations.
+         * Frequent GVT computations reduce memory usage, but threads must synchronize more often.
+         * @param period number of events.
+         */
+        void setGVTPeriod(unsigned int period) {
+            gvtPeriod = std::max(period, 1U);
+        }
+
+        void start() {
+            rootCoordinator->start();
+            const auto& subcomponents = rootCoordinator->getTopCoordinator()->getSubcomponents();
+            for (std::size_t i = 0; i < lps.size(); ++i) {
+                lps[i].modelId = subcomponents[i]->getModelId();
+            }
+        }
+
+        void stop() {
+            rootCoordinator->stop();
+        }
+
+        void simulate(double timeInterval, unsigned int thread_number = std::thread::hardware_concurrency()) {
+            auto logger = rootCoordinator->getLogger();
+            // Logs are committed by only one thread
+            if (logger != nullptr) {
+                logger->removeMutex();
+            }
+            double timeFinal = rootCoordinator->getTopCoordinator()->getTimeLast() + timeInterval;
+            // GVT is double-buffered, so we can reset one of them while the other is being reduced
+            VirtualTime gvt[2] = {VirtualTime::infinity(), VirtualTime::infinity()};
+            // We also reduce the key of the next event and the LP with the earliest speculative exception
+            std::pair<VirtualTime, bool> nextKey[2] = {{VirtualTime::infinity(), false}, {VirtualTime::infinity(), false}};
+            std::size_t failedLP[2] = {lps.size(), lps.size()};
+            std::vector<TimeWarpInbox> inboxes(thread_number);
+            std::vector<std::vector<DeferredLog>> committed(thread_number);
+            std::exception_ptr error;  // exceptions must not escape the parallel region
+
+			#pragma omp parallel default(shared) num_threads(thread_number)
+            {
+                std::size_t tid = omp_get_thread_num();
+                std::size_t nThreads = omp_get_num_threads();
+                std::size_t nLPs = lps.size();
+                auto first = nLPs * tid / nThreads;
+                auto last = nLPs * (tid + 1) / nThreads;
+                auto owner = [nLPs, nThreads](std::size_t i) {
+                    return ((i + 1) * nThreads - 1) / nLPs;
+                };
+                auto send = [&inboxes, &owner](TimeWarpMessage msg) {
+                    auto& inbox = inboxes[owner(msg.receiver)];
+                    std::lock_guard<std::mutex> lock(inbox.mutex);
+                    inbox.messages.push_back(std::move(msg));
+                };
+
+                // Each thread schedules the events of its LPs in virtual time order
+                std::set<std::pair<std::pair<VirtualTime, bool>, std::size_t>> schedule;
+                for (auto i = first; i < last; ++i) {
+                    lps[i].key = lps[i].nextEvent();
+                    schedule.emplace(lps[i].key, i);
+                }
+                auto reschedule = [this, &schedule](std::size_t i) {
+                    auto& lp = lps[i];
+                    schedule.erase({lp.key, i});
+                    lp.key = lp.nextEvent();
+                    if (lp.error == nullptr) {  // LPs that failed wait until they are rolled back
+                        schedule.emplace(lp.key, i);
+                    }
+                };
+
+                std::vector<TimeWarpMessage> received;
+                std::size_t epoch = 0;
+                while (true) {
+                    try {
+                        for (unsigned int n = 0; n < gvtPeriod; ++n) {
+                            // First, we handle incoming messages and anti-messages
+                            {
+                                std::lock_guard<std::mutex> lock(inboxes[tid].mutex);
+                                std::swap(received, inboxes[tid].messages);
+                            }
+                            for (auto& msg: received) {
+                                auto i = msg.receiver;
+                                (msg.anti) ? cancel(i, msg, send) : enqueue(i, std::move(msg), send);
+                                reschedule(i);
+                            }
+                            received.clear();
+                            // Then, we execute the next event (if any)
+                            if (schedule.empty() || schedule.begin()->first.first.time >= timeFinal) {
+                                break;
+                            }
+                            auto i = schedule.begin()->second;
+                            try {
+                                (lps[i].key.second) ? transition(i, logger != nullptr) : collection(i, logger != nullptr, send);
+                            } catch (...) {
+                                // The event may be undone by a straggler, so we do not rethrow the exception yet
+                                lps[i].error = std::current_exception();
+                                lps[i].errorKey = lps[i].key;
+                            }
+                            reschedule(i);
+                        }
+                    } catch (...) {
+						#pragma omp critical
+                        error = std::current_exception();
+                    }
+
+                    // Global virtual time computation
+					#pragma omp barrier
+                    if (tid == 0) {
+                        gvt[(epoch + 1) % 2] = VirtualTime::infinity();
+                        nextKey[(epoch + 1) % 2] = {VirtualTime::infinity(), false};
+                        failedLP[(epoch + 1) % 2] = lps.size();
+                    }
+                    auto localKey = (schedule.empty()) ? std::make_pair(VirtualTime::infinity(), false) : schedule.begin()->first;
+                    for (const auto& msg: inboxes[tid].messages) {
+                        localKey = std::min(localKey, std::make_pair(msg.vt, false));  // messages may undo collections
+                    }
+                    auto localMin = localKey.first;
+                    auto localFailed = lps.size();
+                    for (auto i = first; i < last; ++i) {
+                        if (lps[i].error != nullptr && (localFailed == lps.size() || lps[i].errorKey < lps[localFailed].errorKey)) {
+                            localFailed = i;
+                            localMin = std::min(localMin, lps[i].errorKey.first);  // GVT must not go past failed events
+                        }
+                    }
+                    bool failed;
+					#pragma omp critical
+                    {
+                        gvt[epoch % 2] = std::min(gvt[epoch % 2], localMin);
+                        nextKey[epoch % 2] = std::min(nextKey[epoch % 2], localKey);
+                        auto& globalFailed = failedLP[epoch % 2];
+                        if (localFailed != lps.size() && (globalFailed == lps.size() || lps[localFailed].errorKey < lps[globalFailed].errorKey)) {
+                            globalFailed = localFailed;
+                        }
+                        failed = error != nullptr;  // errors are only raised before the first barrier
+                    }
+					#pragma omp barrier
+                    auto globalMin = gvt[epoch % 2];
+                    auto globalKey = nextKey[epoch % 2];
+                    auto globalFailed = failedLP[epoch++ % 2];
+                    if (failed) {
+                        break;  // all the threads stop in the same epoch
+                    }
+
+                    // Fossil collection: events older than GVT are committed
+                    for (auto i = first; i < last; ++i) {
+                        auto& lp = lps[i];
+                        while (!lp.processed.empty() && lp.processed.front().vt < globalMin) {
+                            lp.processed.pop_front();
+                        }
+                        moveDeferredLogs(lp.logs, committed[tid], globalMin);
+                    }
+                    if (logger != nullptr) {
+						#pragma omp barrier
+						#pragma omp single
+                        {
+                            commitDeferredLogs(logger, committed, rootCoordinator->getTopCoordinator()->getSubcomponents());
+                        }
+                    }
+                    // A speculative exception is committed when no pending event or message can undo the failed event
+                    if (globalFailed != lps.size() && lps[globalFailed].errorKey <= globalKey) {
+                        if (tid == 0) {
+                            error = lps[globalFailed].error;
+                        }
+                        break;
+                    }
+                    if (globalMin.time >= timeFinal) {
+                        break;
+                    }
+                }
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+     private:
+        /**
+         * It triggers the output function of a logical process and sends the resulting messages.
+         * @tparam F type of the function for sending messages.
+         * @param i index of the logical process.
+         * @param logging if true, the logical process buffers log entries of the output messages.
+         * @param send function for sending messages to other logical processes.
+         */
+        template <typename F>
+        void collection(std::size_t i, bool logging, F&& send) {
+            auto& lp = lps[i];
+            auto vt = lp.timeNext;
+            TimeWarpEvent event{vt, false, false, {}, lp.timeLast, lp.timeNext, {}, {}};
+            try {
+                lp.model->output();
+            } catch (...) {
+                lp.model->clearPorts();
+                throw;
+            }
+            for (const auto& [portFrom, destinations]: lp.outgoing) {
+                if (portFrom->empty()) {
+                    continue;
+                }
+                std::shared_ptr<PortInterface> bag = portFrom->newCompatiblePort(portFrom->getId());
+                bag->propagate(portFrom);
+                for (const auto& [portTo, receiver]: destinations) {
+                    event.outputs.push_back({vt, i, receiver, lp.nextSeq++, false, portTo, bag});
+                    send(event.outputs.back());
+                }
+            }
+            if (logging) {
+                for (const auto& outPort: lp.model->getOutPorts()) {
+                    for (std::size_t j = 0; j < outPort->size(); ++j) {
+                        lp.logs.push_back({vt, lp.modelId, outPort->getId(), outPort->logMessage(j), false});
+                    }
+                }
+            }
+            lp.model->clearPorts();
+            lp.collected = true;
+            lp.processed.push_back(std::move(event));
+        }
+
+        /**
+         * It triggers the corresponding state transition function of a logical process.
+         * @param i index of the logical process.
+         * @param logging if true, the logical process buffers log entries of the new state.
+         */
+        void transition(std::size_t i, bool logging) {
+            auto& lp = lps[i];
+            auto vt = lp.key.first;
+            TimeWarpEvent event{vt, true, lp.collected, lp.model->saveState(), lp.timeLast, lp.timeNext, {}, {}};
+            while (!lp.pending.empty() && lp.pending.begin()->first == vt) {
+                event.inputs.push_back(std::move(lp.pending.begin()->second));
+                lp.pending.erase(lp.pending.begin());
+            }
+            double sigma;
+            try {
+                for (const auto& msg: event.inputs) {
+                    msg.portTo->propagate(msg.bag);
+                }
+                if (event.inputs.empty()) {
+                    lp.model->internalTransition();
+                } else {
+                    auto e = vt.time - lp.timeLast;
+                    (vt == lp.timeNext) ? lp.model->confluentTransition(e) : lp.model->externalTransition(e);
+                }
+                sigma = lp.model->timeAdvance();
+                if (logging) {
+                    lp.logs.push_back({vt, lp.modelId, "", lp.model->logState(), true});
+                }
+            } catch (...) {
+                // We leave the LP as it was before the event, so it can be rolled back and re-executed later
+                lp.model->clearPorts();
+                lp.model->restoreState(event.state);
+                for (auto& msg: event.inputs) {
+                    lp.pending.emplace(msg.vt, std::move(msg));
+                }
+                throw;
+            }
+            lp.model->clearPorts();
+            lp.timeLast = vt.time;
+            lp.timeNext = vt.advance(sigma);
+            lp.collected = false;
+            lp.processed.push_back(std::move(event));
+        }
+
+        /**
+         * It undoes all the events of a logical process that may be affected by a message with a given virtual time.
+         * These are state transitions with a greater or equal virtual time and collections with a greater virtual time.
+         * @tparam F type of the function for sending messages.
+         * @param i index of the logical process.
+         * @param vt virtual time to roll back to.
+         * @param send function for sending anti-messages to other logical processes.
+         */
+        template <typename F>
+        void rollback(std::size_t i, const VirtualTime& vt, F&& send) {
+            auto& lp = lps[i];
+            auto undo = [&vt](const auto& entry) {
+                return (entry.transition) ? entry.vt >= vt : entry.vt > vt;
+            };
+            std::optional<std::any> state;  // We only need to restore the oldest state
+            while (!lp.processed.empty() && undo(lp.processed.back())) {
+                auto& event = lp.processed.back();
+                for (auto& msg: event.outputs) {
+                    msg.anti = true;
+                    msg.bag = nullptr;
+                    send(std::move(msg));
+                }
+                for (auto& msg: event.inputs) {
+                    lp.pending.emplace(msg.vt, std::move(msg));
+                }
+                lp.timeLast = event.timeLast;
+                lp.timeNext = event.timeNext;
+                lp.collected = event.collected;
+                if (event.transition) {
+                    state = std::move(event.state);
+                }
+                lp.processed.pop_back();
+            }
+            if (state.has_value()) {
+                lp.model->restoreState(state.value());
+            }
+            while (!lp.logs.empty() && ((lp.logs.back().state) ? lp.logs.back().vt >= vt : lp.logs.back().vt > vt)) {
+                lp.logs.pop_back();
+            }
+            if (lp.error != nullptr && ((lp.errorKey.second) ? lp.errorKey.first >= vt : lp.errorKey.first > vt)) {
+                lp.error = nullptr;  // the failed event is undone, so the exception is discarded
+            }
+        }
+
+        /**
+         * It adds a new input message to a logical process. If the message is a straggler, it rolls back the process.
+         * @tparam F type of the function for sending messages.
+         * @param i index of the logical process.
+         * @param msg new message.
+         * @param send function for sending anti-messages to other logical processes.
+         */
+        template <typename F>
+        void enqueue(std::size_t i, TimeWarpMessage msg, F&& send) {
+            rollback(i, msg.vt, send);
+            lps[i].pending.emplace(msg.vt, std::move(msg));
+        }
+
+        /**
+         * It annihilates a message with its corresponding anti-message. If the message was already processed,
+         * it rolls back the logical process first.
+         * @tparam F type of the function for sending messages.
+         * @param i index of the logical process.
+         * @param anti anti-message.
+         * @param send function for sending anti-messages to other logical processes.
+         */
+        template <typename F>
+        void cancel(std::size_t i, const TimeWarpMessage& anti, F&& send) {
+            auto& lp = lps[i];
+            auto& pending = lp.pending;
+            auto match = [&pending, &anti]() {
+                auto [from, to] = pending.equal_range(anti.vt);
+                return std::find_if(from, to, [&anti](const auto& entry) {
+                    return entry.second.sender == anti.sender && entry.second.seq == anti.seq;
+                });
+            };
+            auto it = match();
+            if (it == pending.upper_bound(anti.vt)) {
+                rollback(i, anti.vt, send);
+                it = match();
+                if (it == pending.upper_bound(anti.vt)) {
+                    throw CadmiumSimulationException("anti-message does not match any message");
+                }
+            }
+            pending.erase(it);
+            if (lp.error != nullptr && lp.errorKey == std::make_pair(anti.vt, true)) {
+                lp.error = nullptr;  // the failed state transition consumed the canceled message
+            }
+        }
+    };
+}
+
+#endif //CADMIUM_CORE_SIMULATION_TIME_WARP_ROOT_COORDINATOR_HPP_
@@ -0,0 +1,91 @@
+/**
+ * Virtual time for distributed and parallel DEVS simulators.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_SIMULATION_VIRTUAL_TIME_HPP_
+#define CADMIUM_CORE_SIMULATION_VIRTUAL_TIME_HPP_
+
+#include <limits>
+#include <ostream>
+
+namespace cadmium {
+    /**
+     * @brief Virtual time of DEVS simulation events.
+     *
+     * Sequential coordinators execute simulation steps with the same simulation time one after the other.
+     * When simulators do not share a global simulation loop, they need to tell these steps apart.
+     * Thus, virtual time is composed of the simulation time and the round (i.e., the number of preceding
+     * simulation steps that occurred at the same simulation time). Virtual times are sorted lexicographically.
+     */
+    struct VirtualTime {
+        double time;  //!< Simulation time.
+        long round;   //!< Number of preceding simulation steps with the same simulation time.
+
+        //! Default constructor function. It sets the virtual time to 0.
+        VirtualTime(): time(), round() {}
+
+        /**
+         * Constructor function.
+         * @param time simulation time.
+         * @param round number of preceding simulation steps with the same simulation time.
+         */
+        VirtualTime(double time, long round): time(time), round(round) {}
+
+        //! @return virtual time that is greater than any other virtual time.
+        static VirtualTime infinity() {
+            return {std::numeric_limits<double>::infinity(), 0};
+        }
+
+        /**
+         * It computes the virtual time of the next internal transition of a model.
+         * @param ta time advance of the model after a state transition with this virtual time.
+         * @return virtual time of the next internal transition of the model.
+         */
+        [[nodiscard]] VirtualTime advance(double ta) const {
+            if (ta == std::numeric_limits<double>::infinity()) {
+                return infinity();
+            }
+            return (ta == 0) ? VirtualTime(time, round + 1) : VirtualTime(time + ta, 0);
+        }
+
+        bool operator==(const VirtualTime& other) const {
+            return time == other.time && round == other.round;
+        }
+
+        bool operator!=(const VirtualTime& other) const {
+            return !(*this == other);
+        }
+
+        bool operator<(const VirtualTime& other) const {
+            return time < other.time || (time == other.time && round < other.round);
+        }
+
+        bool operator<=(const VirtualTime& other) const {
+            return !(other < *this);
+        }
+
+        bool operator>(const VirtualTime& other) const {
+            return other < *this;
+        }
+
+        bool operator>=(const VirtualTime& other) const {
+            return !(*this < other);
+        }
+    };
+
+    /**
+     * Insertion operator for VirtualTime objects.
+     * @param out output stream.
+     * @param vt virtual time to be inserted.
+     * @return output stream with the virtual time already inserted.
+     */
+    inline std::ostream& operator<<(std::ostream& out, const VirtualTime& vt) {
+        out << "(" << vt.time << "," << vt.round << ")";
+        return out;
+    }
+}
+
+#endif //CADMIUM_CORE_SIMULATION_VIRTUAL_TIME_HPP_
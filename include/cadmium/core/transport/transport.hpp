@@ -0,0 +1,86 @@
+/**
+ * Abstract transport for distributed simulation.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_TRANSPORT_TRANSPORT_HPP_
+#define CADMIUM_CORE_TRANSPORT_TRANSPORT_HPP_
+
+#include <algorithm>
+#include <vector>
+#include "../exception.hpp"
+#include "../modeling/serialization.hpp"
+
+namespace cadmium {
+    /**
+     * @brief Interface for exchanging data between the processes (ranks) of a distributed simulation.
+     *
+     * Implementations only need to provide a paired send/receive operation. Collective operations
+     * used by distributed coordinators are built on top of it.
+     */
+    class Transport {
+     public:
+        //! Default virtual destructor function.
+        virtual ~Transport() = default;
+
+        //! @return rank of the current process. Ranks go from 0 to getSize() - 1.
+        [[nodiscard]] virtual int getRank() const = 0;
+
+        //! @return number of processes of the distributed simulation.
+        [[nodiscard]] virtual int getSize() const = 0;
+
+        /**
+         * It sends a buffer to one process and receives a buffer from another process at the same time.
+         * Implementations must not deadlock when all the processes call this method at once, regardless of buffer sizes.
+         * @param dest rank of the destination process.
+         * @param data buffer to be sent.
+         * @param source rank of the source process.
+         * @return buffer received from the source process.
+         */
+        virtual std::vector<char> sendReceive(int dest, const std::vector<char>& data, int source) = 0;
+
+        /**
+         * It sends a different buffer to every process and receives one buffer from every process.
+         * All the processes must call this method at the same time.
+         * @param outgoing buffers to be sent. The ith buffer goes to the process with rank i.
+         * @return received buffers. The ith buffer comes from the process with rank i.
+         */
+        std::vector<std::vector<char>> allToAll(std::vector<std::vector<char>> outgoing) {
+            auto rank = getRank();
+            auto size = getSize();
+            if (outgoing.size() != static_cast<std::size_t>(size)) {
+                throw CadmiumSimulationException("invalid number of outgoing buffers");
+            }
+            std::vector<std::vector<char>> incoming(size);
+            incoming[rank] = std::move(outgoing[rank]);
+            // In the ith round, every process sends to rank + i and receives from rank - i
+            for (int i = 1; i < size; ++i) {
+                auto dest = (rank + i) % size;
+                auto source = (rank + size - i) % size;
+                incoming[source] = sendReceive(dest, outgoing[dest], source);
+            }
+            return incoming;
+        }
+
+        /**
+         * It computes the minimum of a value across all the processes.
+         * All the processes must call this method at the same time.
+         * @param value local value.
+         * @return minimum value.
+         */
+        double allReduceMin(double value) {
+            std::vector<char> buffer;
+            Serializer<double>::write(buffer, value);
+            auto incoming = allToAll(std::vector<std::vector<char>>(getSize(), buffer));
+            for (const auto& data: incoming) {
+                const char* cursor = data.data();
+                value = std::min(value, Serializer<double>::read(cursor, data.data() + data.size()));
+            }
+            return value;
+        }
+    };
+}
+
+#endif //CADMIUM_CORE_TRANSPORT_TRANSPORT_HPP_
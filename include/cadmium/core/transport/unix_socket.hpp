@@ -0,0 +1,196 @@
+/**
+ * Unix domain socket transport for distributed simulation in a single host.
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#ifndef CADMIUM_CORE_TRANSPORT_UNIX_SOCKET_HPP_
+#define CADMIUM_CORE_TRANSPORT_UNIX_SOCKET_HPP_
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <poll.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+#include "transport.hpp"
+#include "../exception.hpp"
+
+namespace cadmium {
+    /**
+     * @brief Transport based on Unix domain sockets.
+     *
+     * Processes are created with the fork() static method. Every pair of processes is connected with a socket pair.
+     * It is intended for testing distributed simulations in a single host. The process with rank 0 waits for the
+     * rest of processes when its transport is destroyed.
+     */
+    class UnixSocketTransport: public Transport {
+     private:
+        int rank;                   //!< Rank of the current process.
+        std::vector<int> sockets;   //!< File descriptor of the socket connected to each process (-1 for itself).
+        std::vector<pid_t> children; //!< Process IDs of the child processes. Only rank 0 has children.
+
+        UnixSocketTransport(int rank, std::vector<int> sockets, std::vector<pid_t> children):
+            Transport(), rank(rank), sockets(std::move(sockets)), children(std::move(children)) {}
+
+        [[noreturn]] static void fail(const std::string& what) {
+            throw CadmiumSimulationException(what + ": " + std::strerror(errno));
+        }
+
+     public:
+        /**
+         * It forks the current process and connects all the resulting processes.
+         * The calling process gets rank 0. Child processes continue from this call with ranks 1 to nProcesses - 1.
+         * @param nProcesses total number of processes.
+         * @return transport of the current process.
+         */
+        static std::shared_ptr<UnixSocketTransport> fork(int nProcesses) {
+            if (nProcesses < 1) {
+                throw CadmiumSimulationException("the number of processes must be greater than 0");
+            }
+            // First, we create one socket pair for every pair of processes
+            std::vector<std::vector<int>> pairs(nProcesses, std::vector<int>(nProcesses, -1));
+            for (int i = 0; i < nProcesses; ++i) {
+                for (int j = i + 1; j < nProcesses; ++j) {
+                    int sv[2];
+                    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0) {
+                        fail("unable to create socket pair");
+                    }
+                    pairs[i][j] = sv[0];
+                    pairs[j][i] = sv[1];
+                }
+            }
+            // Then, we create the child processes
+            int rank = 0;
+            std::vector<pid_t> children;
+            for (int r = 1; r < nProcesses; ++r) {
+                auto pid = ::fork();
+                if (pid < 0) {
+                    fail("unable to fork process");
+                }
+                if (pid == 0) {
+                    rank = r;
+                    children.clear();
+                    break;
+                }
+                children.push_back(pid);
+            }
+            // Finally, every process closes the sockets of other processes
+            for (int i = 0; i < nProcesses; ++i) {
+                for (int j = 0; j < nProcesses; ++j) {
+                    if (i != rank && pairs[i][j] >= 0) {
+                        close(pairs[i][j]);
+                    }
+                }
+            }
+            for (auto fd: pairs[rank]) {
+                if (fd >= 0 && fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) < 0) {
+                    fail("unable to configure socket");
+                }
+            }
+            return std::shared_ptr<UnixSocketTransport>(new UnixSocketTransport(rank, pairs[rank], std::move(children)));
+        }
+
+        //! It closes all the sockets. Rank 0 also waits for the child processes to finish.
+        ~UnixSocketTransport() override {
+            for (auto fd: sockets) {
+                if (fd >= 0) {
+                    close(fd);
+                }
+            }
+            for (auto pid: children) {
+                waitpid(pid, nullptr, 0);
+            }
+        }
+
+        [[nodiscard]] int getRank() const override {
+            return rank;
+        }
+
+        [[nodiscard]] int getSize() const override {
+            return static_cast<int>(sockets.size());
+        }
+
+        /**
+         * It sends a buffer to one process and receives a buffer from another process at the same time.
+         * Buffers are preceded by their length. Sending and receiving are interleaved with poll() to avoid deadlocks.
+         * @param dest rank of the destination process.
+         * @param data buffer to be sent.
+         * @param source rank of the source process.
+         * @return buffer received from the source process.
+         */
+        std::vector<char> sendReceive(int dest, const std::vector<char>& data, int source) override {
+            if (dest == rank || source == rank) {
+                throw CadmiumSimulationException("processes cannot send data to themselves");
+            }
+            std::vector<char> out;
+            Serializer<std::uint64_t>::write(out, data.size());
+            out.insert(out.end(), data.begin(), data.end());
+            std::size_t sent = 0;
+
+            char header[sizeof(std::uint64_t)];
+            std::size_t headerReceived = 0;
+            std::vector<char> in;
+            std::size_t received = 0;
+            bool inDone = false;
+
+            while (sent < out.size() || !inDone) {
+                pollfd fds[2];
+                nfds_t nfds = 0;
+                int sendIdx = -1, recvIdx = -1;
+                if (sent < out.size()) {
+                    sendIdx = static_cast<int>(nfds);
+                    fds[nfds++] = {sockets[dest], POLLOUT, 0};
+                }
+                if (!inDone) {
+                    recvIdx = static_cast<int>(nfds);
+                    fds[nfds++] = {sockets[source], POLLIN, 0};
+                }
+                if (poll(fds, nfds, -1) < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    fail("unable to poll sockets");
+                }
+                if (sendIdx >= 0 && fds[sendIdx].revents != 0) {
+                    auto n = send(sockets[dest], out.data() + sent, out.size() - sent, MSG_NOSIGNAL);
+                    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                        fail("unable to send data");
+                    }
+                    sent += (n > 0) ? n : 0;
+                }
+                if (recvIdx >= 0 && fds[recvIdx].revents != 0) {
+                    char* dst = (headerReceived < sizeof(header)) ? header + headerReceived : in.data() + received;
+                    auto len = (headerReceived < sizeof(header)) ? sizeof(header) - headerReceived : in.size() - received;
+                    auto n = recv(sockets[source], dst, len, 0);
+                    if (n == 0) {
+                        throw CadmiumSimulationException("connection closed by process " + std::to_string(source));
+                    }
+                    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                        fail("unable to receive data");
+                    }
+                    if (n > 0 && headerReceived < sizeof(header)) {
+                        headerReceived += n;
+                        if (headerReceived == sizeof(header)) {
+                            const char* cursor = header;
+                            in.resize(Serializer<std::uint64_t>::read(cursor, header + sizeof(header)));
+                        }
+                    } else if (n > 0) {
+                        received += n;
+                    }
+                    inDone = headerReceived == sizeof(header) && received == in.size();
+                }
+            }
+            return in;
+        }
+    };
+}
+
+#endif //CADMIUM_CORE_TRANSPORT_UNIX_SOCKET_HPP_
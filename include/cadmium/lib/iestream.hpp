@@ -18,8 +18,9 @@ namespace cadmium::lib {
     /**
      * Input event parser.
      * @tparam MSG data type of the event to be parsed
+     * @tparam T data type used for representing the simulation time. By default, it is double.
      */
-    template<typename MSG>
+    template<typename MSG, typename T = double>
     class EventParser {
      private:
         std::ifstream file; //!< input file stream of the file with all the events to be injected.
@@ -45,9 +46,9 @@ namespace cadmium::lib {
          * If the parser has reached the end of the file, it returns infinity and an empty event.
          * @return tuple <next time, next event>.
          */
-        std::pair<double, std::optional<MSG>> nextTimedInput() {
+        std::pair<T, std::optional<MSG>> nextTimedInput() {
             // Default return values: infinity and none
-            double sigma = std::numeric_limits<double>::infinity();
+            T sigma = TimeTraits<T>::infinity();
             std::optional<MSG> contents = std::optional<MSG>();
             if (file.is_open() && !file.eof()) {
                 file >> sigma; // read time of next message
@@ -62,19 +63,20 @@ namespace cadmium::lib {
     /**
      * Class for representing the Input Event Stream DEVS model state.
      * @tparam MSG data type of the event to be parsed
+     * @tparam T data type used for representing the simulation time. By default, it is double.
      */
-    template<typename MSG>
+    template<typename MSG, typename T = double>
     struct IEStreamState {
-        EventParser<MSG> parser;  //!< Input events parser.
+        EventParser<MSG, T> parser;  //!< Input events parser.
         std::optional<MSG> lastInputRead;  //!< las input messages read from the file.
-        double clock;  //!< Current simulation time.
-        double sigma;  //!< Time to wait before outputting the next event.
+        T clock;  //!< Current simulation time.
+        T sigma;  //!< Time to wait before outputting the next event.
 
         /**
          * Processor state constructor. By default, the processor is idling.
          * @param filePath path to the file containing the events.
          */
-        explicit IEStreamState(const char* filePath): parser(EventParser<MSG>(filePath)), lastInputRead(), clock(), sigma() {
+        explicit IEStreamState(const char* filePath): parser(EventParser<MSG, T>(filePath)), lastInputRead(), clock(), sigma() {
             auto [nextTime, nextEvent] = parser.nextTimedInput();
             sigma = nextTime;
             lastInputRead = nextEvent;
@@ -87,8 +89,8 @@ namespace cadmium::lib {
      * @param s state to be represented in the output stream.
      * @return output stream with sigma already inserted.
      */
-    template<typename MSG>
-    std::ostream& operator<<(std::ostream &out, const IEStreamState<MSG>& state) {
+    template<typename MSG, typename T>
+    std::ostream& operator<<(std::ostream &out, const IEStreamState<MSG, T>& state) {
         out << state.sigma;
         return out;
     }
@@ -96,9 +98,10 @@ namespace cadmium::lib {
     /**
      * Atomic DEVS model for injecting input events from a file.
      * @tparam MSG message type of the events to be injected.
+     * @tparam T data type used for representing the simulation time. By default, it is double.
      */
-    template<typename MSG>
-    class IEStream : public Atomic<IEStreamState<MSG>> {
+    template<typename MSG, typename T = double>
+    class IEStream : public Atomic<IEStreamState<MSG, T>, T> {
      public:
         Port<MSG> out;
 
@@ -107,8 +110,8 @@ namespace cadmium::lib {
          * @param id ID of the new input event stream model.
          * @param filePath path to the file with the events to be injected
          */
-        IEStream(const std::string& id, const char* filePath): Atomic<IEStreamState<MSG>>(id, IEStreamState<MSG>(filePath)) {
-            out = Atomic<IEStreamState<MSG>>::template addOutPort<MSG>("out");
+        IEStream(const std::string& id, const char* filePath): Atomic<IEStreamState<MSG, T>, T>(id, IEStreamState<MSG, T>(filePath)) {
+            out = Atomic<IEStreamState<MSG, T>, T>::template addOutPort<MSG>("out");
         }
 
         /**
@@ -116,7 +119,7 @@ namespace cadmium::lib {
          * if the time to be sent is in the past, then passivate model
          * @param state reference to the current state of the model.
          */
-        void internalTransition(IEStreamState<MSG>& state) const override {
+        void internalTransition(IEStreamState<MSG, T>& state) const override {
             state.clock += state.sigma;
             while(true) {  // loop to ignore outdated events
                 auto [nextTime, nextEvent] = state.parser.nextTimedInput();
@@ -135,7 +138,7 @@ namespace cadmium::lib {
          * @param state reference to the current model state.
          * @param e time elapsed since the last state transition function was triggered.
          */
-        void externalTransition(IEStreamState<MSG>& state, double e) const override {
+        void externalTransition(IEStreamState<MSG, T>& state, T e) const override {
             // External Events should not occur for this model
             state.clock += e;
             state.sigma -= e;
@@ -145,7 +148,7 @@ namespace cadmium::lib {
          * It outputs the next message
          * @param state reference to the current model state.
          */
-        void output(const IEStreamState<MSG>& state) const override {
+        void output(const IEStreamState<MSG, T>& state) const override {
             if(state.lastInputRead.has_value()){
                 out->addMessage(state.lastInputRead.value());
             }
@@ -156,7 +159,7 @@ namespace cadmium::lib {
          * @param state reference to the current model state.
          * @return the sigma value.
          */
-        [[nodiscard]] double timeAdvance(const IEStreamState<MSG>& state) const override {
+        [[nodiscard]] T timeAdvance(const IEStreamState<MSG, T>& state) const override {
             return state.sigma;
         }
     };
@@ -0,0 +1,235 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#define BOOST_TEST_MODULE BatchSIRTests
+#include <boost/test/unit_test.hpp>
+#include <cadmium/celldevs/core/batch.hpp>
+#include <cadmium/celldevs/core/cell.hpp>
+#include <cadmium/celldevs/core/config.hpp>
+#include <cadmium/celldevs/grid/coupled.hpp>
+#include <cadmium/core/modeling/time.hpp>
+#include <cadmium/core/simulation/root_coordinator.hpp>
+#include <array>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include "../../example/celldevs_sir/include/batch_state.hpp"
+#include "../../example/celldevs_sir/include/grid_sir_batch_cell.hpp"
+#include "../../example/celldevs_sir/include/grid_sir_cell.hpp"
+#include "../../example/celldevs_sir/include/state.hpp"
+
+using namespace cadmium;
+using namespace cadmium::celldevs;
+using namespace cadmium::celldevs::example::sir;
+
+constexpr std::size_t N_LANES = 4;  //!< Number of replications simulated at once.
+using SIRBatch = SIRBatchState<N_LANES>;
+using Time = FixedPoint<1000>;      //!< Batch cells of the ring work with a time type other than double.
+
+//! Configuration of a ring of cells with three neighbors: the previous cell, the cell itself, and the next cell.
+template <typename S>
+struct RingConfig: public CellConfig<int, S, double> {
+	int nCells;  //!< Number of cells in the ring.
+
+	RingConfig(int nCells, const nlohmann::json& configParams): CellConfig<int, S, double>("default", configParams), nCells(nCells) {}
+
+	std::unordered_map<int, NeighborData<S, double>> buildNeighborhood(const int& cellId) const override {
+		return {
+			{(cellId + nCells - 1) % nCells, NeighborData<S, double>(1)},
+			{cellId, NeighborData<S, double>(1)},
+			{(cellId + 1) % nCells, NeighborData<S, double>(1)},
+		};
+	}
+};
+
+//! Cell of a ring. Its population is the sum of the population of its neighbors. Its output delay is configurable.
+struct RingCell: public Cell<int, SIRState, double, Time> {
+	Time delay;  //!< Output delay of the cell.
+
+	RingCell(int id, const std::shared_ptr<const RingConfig<SIRState>>& config, Time delay): Cell<int, SIRState, double, Time>(id, config), delay(delay) {}
+
+	[[nodiscard]] SIRState localComputation(SIRState state, NeighborSpan<SIRState, double> neighbors) const override {
+		state.p = 0;
+		for (const auto& [neighborState, vicinity]: neighbors) {
+			state.p += neighborState->p;
+		}
+		return state;
+	}
+
+	[[nodiscard]] Time outputDelay(const SIRState& state) const override {
+		return delay;
+	}
+};
+
+//! Batch cell of a ring. Every lane behaves as a RingCell, and the output delay of lane k is (k + 1) / 2.
+struct RingBatchCell: public BatchCell<int, SIRBatch, double, Time> {
+	RingBatchCell(int id, const std::shared_ptr<const RingConfig<SIRBatch>>& config): BatchCell<int, SIRBatch, double, Time>(id, config) {}
+
+	[[nodiscard]] SIRBatch localComputation(SIRBatch state, NeighborSpan<SIRBatch, double> neighbors) const override {
+		state.p.fill(0);
+		for (const auto& [neighborState, vicinity]: neighbors) {
+			for (std::size_t k = 0; k < N_LANES; ++k) {
+				state.p[k] += neighborState->p[k];
+			}
+		}
+		return state;
+	}
+
+	[[nodiscard]] static Time laneDelay(std::size_t lane) {
+		return Time(0.5 * static_cast<double>(lane + 1));
+	}
+
+	[[nodiscard]] Time outputDelay(const SIRBatch& state, std::size_t lane) const override {
+		return laneDelay(lane);
+	}
+
+	[[nodiscard]] Time outputDelay(const SIRBatch& state) const override {
+		return laneDelay(0);
+	}
+};
+
+std::shared_ptr<GridCell<SIRBatch, double>> addBatchCell(const coordinates& cellId, const std::shared_ptr<const GridCellConfig<SIRBatch, double>>& cellConfig) {
+	if (cellConfig->cellModel == "default" || cellConfig->cellModel == "SIR") {
+		return std::make_shared<GridSIRBatchCell<N_LANES>>(cellId, cellConfig);
+	}
+	throw std::bad_typeid();
+}
+
+std::shared_ptr<GridCell<SIRState, double, 2>> addScalarCell(const gridCoordinates<2>& cellId, const std::shared_ptr<const GridCellConfig<SIRState, double, 2>>& cellConfig) {
+	if (cellConfig->cellModel == "default" || cellConfig->cellModel == "SIR") {
+		return std::make_shared<GridSIRCell>(cellId, cellConfig);
+	}
+	throw std::bad_typeid();
+}
+
+/**
+ * It simulates a grid SIR scenario and returns the final state of every cell.
+ * @tparam S the type used for representing a cell state.
+ * @tparam N number of dimensions of the cell IDs (0 for dynamic dimensions).
+ * @param factory pointer to the cell factory function.
+ * @param config JSON object with the scenario configuration.
+ * @return final state of every cell {cell ID: state}.
+ */
+template <typename S, std::size_t N>
+std::map<std::string, S> simulate(gridCellFactory<S, double, N> factory, const nlohmann::json& config) {
+	std::string path = "batch_sir.json";
+	std::ofstream(path) << config;
+	auto model = std::make_shared<GridCellDEVSCoupled<S, double, N>>("sir", factory, path);
+	model->buildModel();
+	auto rootCoordinator = RootCoordinator(model);
+	rootCoordinator.start();
+	rootCoordinator.simulate(30.);
+	rootCoordinator.stop();
+	std::map<std::string, S> states;
+	for (const auto& cell: model->getCells()) {
+		states[cell->getId()] = cell->getState();
+	}
+	return states;
+}
+
+BOOST_AUTO_TEST_CASE(lanes_vs_scalar) {
+	std::array<double, N_LANES> vir = {0.2, 0.3, 0.4, 0.5};
+	std::array<int, N_LANES> infectedP = {100, 80, 60, 40};
+	nlohmann::json config = {
+		{"scenario", {{"shape", {12, 12}}, {"origin", {-3, -3}}}},
+		{"cells", {
+			{"default", {
+				{"delay", "inertial"},
+				{"state", {{"p", 100}, {"s", 1}, {"i", 0}, {"r", 0}}},
+				{"config", {{"rec", 0.2}, {"susc", 0.8}, {"vir", vir}}},
+				{"neighborhood", {
+					{{"type", "von_neumann"}, {"vicinity", 0.25}, {"range", 1}},
+					{{"type", "relative"}, {"vicinity", 1}, {"neighbors", {{0, 0}}}},
+				}},
+			}},
+			{"infected", {
+				{"state", {{"p", infectedP}, {"s", 0.9}, {"i", 0.1}, {"r", 0}}},
+				{"cell_map", {{0, 0}, {5, 7}}},
+			}},
+		}},
+	};
+	auto batchStates = simulate(addBatchCell, config);
+	// Every lane must reproduce a regular simulation with the parameters of the lane
+	for (std::size_t k = 0; k < N_LANES; ++k) {
+		config["cells"]["default"]["config"]["vir"] = vir[k];
+		config["cells"]["infected"]["state"]["p"] = infectedP[k];
+		auto scalarStates = simulate(addScalarCell, config);
+		BOOST_REQUIRE_EQUAL(batchStates.size(), scalarStates.size());
+		std::size_t nInfected = 0;
+		for (const auto& [cellId, state]: scalarStates) {
+			const auto& batch = batchStates.at(cellId);
+			BOOST_CHECK_MESSAGE(batch.p[k] == state.p && batch.s[k] == state.s && batch.i[k] == state.i && batch.r[k] == state.r,
+			  "cell " << cellId << " differs in lane " << k);
+			nInfected += state.r > 0;
+		}
+		BOOST_CHECK_GT(nInfected, 2);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(lane_delays) {
+	auto scalarConfig = std::make_shared<RingConfig<SIRState>>(10, nlohmann::json::object());
+	auto batchConfig = std::make_shared<RingConfig<SIRBatch>>(10, nlohmann::json::object());
+	auto batch = RingBatchCell(0, batchConfig);
+	auto& batchAtomic = static_cast<BasicAtomicInterface<Time>&>(batch);
+	auto batchOut = std::dynamic_pointer_cast<_BigPort<CellStateMessage<int, SIRBatch>>>(batch.getOutPort("outputNeighborhood"));
+
+	// All the lanes output their initial state at the beginning of the simulation
+	BOOST_CHECK(batchAtomic.timeAdvance() == Time());
+	batchAtomic.output();
+	BOOST_REQUIRE_EQUAL(batchOut->getBag().size(), 1);
+	BOOST_CHECK(batchOut->getBag().front()->state->mask.all());
+	batchOut->clear();
+	batchAtomic.internalTransition();
+	BOOST_CHECK(batchAtomic.timeAdvance() == TimeTraits<Time>::infinity());
+
+	// Neighbor states are different in every lane
+	for (std::size_t slot = 0; slot < batch.getNeighbors().size(); ++slot) {
+		auto neighborState = std::make_shared<SIRBatch>();
+		for (std::size_t k = 0; k < N_LANES; ++k) {
+			neighborState->p[k] = static_cast<int>((slot + 1) * (k + 1));
+		}
+		neighborState->mask.set();
+		batch.setNeighborState(slot, neighborState);
+	}
+	batchAtomic.externalTransition(Time());
+
+	// Every lane behaves as a regular cell with the output delay of the lane
+	for (std::size_t k = 0; k < N_LANES; ++k) {
+		auto scalar = RingCell(0, scalarConfig, RingBatchCell::laneDelay(k));
+		auto& scalarAtomic = static_cast<BasicAtomicInterface<Time>&>(scalar);
+		scalarAtomic.output();
+		scalarAtomic.internalTransition();
+		for (std::size_t slot = 0; slot < scalar.getNeighbors().size(); ++slot) {
+			auto neighborState = std::make_shared<SIRState>();
+			neighborState->p = static_cast<int>((slot + 1) * (k + 1));
+			scalar.setNeighborState(slot, neighborState);
+		}
+		scalarAtomic.externalTransition(Time());
+		BOOST_CHECK_EQUAL(batch.getState().p[k], scalar.getState().p);
+		BOOST_CHECK(scalarAtomic.timeAdvance() == RingBatchCell::laneDelay(k));
+	}
+
+	// Lanes output their new state one after another, as their output delays are different
+	auto elapsed = Time();
+	for (std::size_t k = 0; k < N_LANES; ++k) {
+		auto ta = batchAtomic.timeAdvance();
+		BOOST_CHECK(elapsed + ta == RingBatchCell::laneDelay(k));
+		elapsed += ta;
+		batchAtomic.output();
+		BOOST_REQUIRE_EQUAL(batchOut->getBag().size(), 1);
+		const auto& msg = *batchOut->getBag().front()->state;
+		BOOST_CHECK_EQUAL(msg.mask.count(), 1);
+		BOOST_CHECK(msg.mask[k]);
+		BOOST_CHECK_EQUAL(msg.p[k], batch.getState().p[k]);
+		batchOut->clear();
+		batchAtomic.internalTransition();
+	}
+	BOOST_CHECK(batchAtomic.timeAdvance() == TimeTraits<Time>::infinity());
+}
@@ -0,0 +1,201 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#define BOOST_TEST_MODULE CellSIRTests
+#include <boost/test/unit_test.hpp>
+#include <cadmium/celldevs/core/cell.hpp>
+#include <cadmium/celldevs/core/config.hpp>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../../example/celldevs_sir/include/state.hpp"
+
+using namespace cadmium::celldevs;
+using namespace cadmium::celldevs::example::sir;
+
+//! Configuration of a ring of cells. It uses the default implementation of buildNeighbors.
+struct RingConfig: public CellConfig<int, SIRState, double> {
+	int nCells;  //!< Number of cells in the ring.
+
+	RingConfig(int nCells, const nlohmann::json& configParams): CellConfig<int, SIRState, double>("default", configParams), nCells(nCells) {}
+
+	std::unordered_map<int, NeighborData<SIRState, double>> buildNeighborhood(const int& cellId) const override {
+		return {
+			{(cellId + nCells - 1) % nCells, NeighborData<SIRState, double>(0.5)},
+			{cellId, NeighborData<SIRState, double>(1)},
+			{(cellId + 1) % nCells, NeighborData<SIRState, double>(0.25)},
+		};
+	}
+};
+
+//! Cell of a ring. Its population is the sum of the population of its neighbors.
+struct RingCell: public Cell<int, SIRState, double> {
+	mutable int nComputations;  //!< Number of times that the local computation function was called.
+
+	RingCell(int id, const std::shared_ptr<const RingConfig>& config): Cell<int, SIRState, double>(id, config), nComputations() {}
+
+	[[nodiscard]] SIRState localComputation(SIRState state, NeighborSpan<SIRState, double> neighbors) const override {
+		++nComputations;
+		state.p = 0;
+		for (const auto& [neighborState, vicinity]: neighbors) {
+			state.p += neighborState->p;
+		}
+		return state;
+	}
+
+	[[nodiscard]] double outputDelay(const SIRState& state) const override {
+		return 1;
+	}
+
+	bool constantDelay(double& delay) const override {
+		delay = 1;
+		return true;
+	}
+};
+
+//! Cell of a ring that only implements the local computation function that receives the unordered map.
+struct MapRingCell: public Cell<int, SIRState, double> {
+	MapRingCell(int id, const std::shared_ptr<const RingConfig>& config): Cell<int, SIRState, double>(id, config) {}
+
+	//! The population of the cell is the sum of the population of its neighbors weighted by their ID plus one.
+	[[nodiscard]] SIRState localComputation(SIRState state, const std::unordered_map<int, NeighborData<SIRState, double>>& neighborhood) const override {
+		state.p = 0;
+		for (const auto& [neighbor, data]: neighborhood) {
+			state.p += (neighbor + 1) * data.state->p;
+		}
+		return state;
+	}
+
+	[[nodiscard]] double outputDelay(const SIRState& state) const override {
+		return 1;
+	}
+};
+
+//! Cell of a ring that does not implement any local computation function.
+struct NoRuleCell: public Cell<int, SIRState, double> {
+	NoRuleCell(int id, const std::shared_ptr<const RingConfig>& config): Cell<int, SIRState, double>(id, config) {}
+
+	[[nodiscard]] double outputDelay(const SIRState& state) const override {
+		return 1;
+	}
+};
+
+//! It returns a pointer to a new SIR state with the given population.
+std::shared_ptr<const SIRState> population(int p) {
+	auto state = std::make_shared<SIRState>();
+	state->p = p;
+	return state;
+}
+
+BOOST_AUTO_TEST_CASE(default_neighbors) {
+	auto config = RingConfig(10, nlohmann::json::object());
+	std::vector<std::vector<std::pair<int, const double*>>> first;
+	for (int cell = 0; cell < config.nCells; ++cell) {
+		first.push_back(config.buildNeighbors(cell));
+		BOOST_CHECK_EQUAL(first.back().size(), 3);
+		for (const auto& [neighbor, vicinity]: first.back()) {
+			BOOST_CHECK_EQUAL(*vicinity, config.buildNeighborhood(cell).at(neighbor).vicinity);
+		}
+	}
+	// Further calls return the same neighbors in the same order, pointing to the vicinities already stored
+	for (int cell = 0; cell < config.nCells; ++cell) {
+		BOOST_CHECK(config.buildNeighbors(cell) == first[cell]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(constant_delay_lookahead) {
+	auto config = std::make_shared<RingConfig>(10, nlohmann::json::object());
+	// Cells with a constant output delay use it as lookahead. Otherwise, they have no lookahead
+	BOOST_CHECK_EQUAL(RingCell(0, config).lookahead(), 1);
+	BOOST_CHECK_EQUAL(MapRingCell(0, config).lookahead(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(active_frontier) {
+	for (auto activeFrontier: {false, true}) {
+		auto config = std::make_shared<RingConfig>(10, nlohmann::json{{"active_frontier", activeFrontier}});
+		auto cell = RingCell(0, config);
+		auto& atomic = static_cast<cadmium::AtomicInterface&>(cell);
+		// Neighbor states are set without messages, as the board coordinator does
+		for (std::size_t slot = 0; slot < cell.getNeighbors().size(); ++slot) {
+			cell.setNeighborState(slot, population(1));
+		}
+		atomic.externalTransition(0);
+		BOOST_CHECK_EQUAL(cell.nComputations, 1);
+		BOOST_CHECK_EQUAL(cell.getState().p, 3);
+		// Equal neighbor states do not trigger the local computation with active frontiers
+		cell.setNeighborState(0, population(1));
+		atomic.externalTransition(0);
+		BOOST_CHECK_EQUAL(cell.nComputations, (activeFrontier) ? 1 : 2);
+		// Different neighbor states always trigger the local computation
+		cell.setNeighborState(0, population(1));
+		cell.setNeighborState(1, population(2));
+		atomic.externalTransition(0);
+		BOOST_CHECK_EQUAL(cell.nComputations, (activeFrontier) ? 2 : 3);
+		BOOST_CHECK_EQUAL(cell.getState().p, 4);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(neighbor_slot) {
+	using Message = CellStateMessage<int, SIRState>;
+	auto config = std::make_shared<RingConfig>(10, nlohmann::json::object());
+	auto neighbors = config->buildNeighbors(0);
+	auto cell = RingCell(0, config);
+	// Cells without indices find the slot of the sender from its ID
+	for (std::size_t slot = 0; slot < neighbors.size(); ++slot) {
+		BOOST_CHECK_EQUAL(cell.neighborSlot(Message(neighbors[slot].first, population(1))), slot);
+	}
+	// The index of every cell is ten times its ID
+	std::vector<std::size_t> indices;
+	for (const auto& [neighbor, vicinity]: neighbors) {
+		indices.push_back(10 * neighbor);
+	}
+	cell.setIndices(0, indices);
+	for (std::size_t slot = 0; slot < neighbors.size(); ++slot) {
+		// Indexed senders are routed by their index, not by their ID
+		auto otherId = neighbors[(slot + 1) % neighbors.size()].first;
+		BOOST_CHECK_EQUAL(cell.neighborSlot(Message(otherId, population(1), indices[slot])), slot);
+		// Senders without index or with an unknown index fall back to their ID
+		BOOST_CHECK_EQUAL(cell.neighborSlot(Message(neighbors[slot].first, population(1))), slot);
+		BOOST_CHECK_EQUAL(cell.neighborSlot(Message(neighbors[slot].first, population(1), 1000)), slot);
+	}
+	// Senders that are not neighbors of the cell throw
+	BOOST_CHECK_THROW((void) cell.neighborSlot(Message(5, population(1))), std::out_of_range);
+	BOOST_CHECK_THROW((void) cell.neighborSlot(Message(5, population(1), 50)), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(neighborhood_messages) {
+	auto config = std::make_shared<RingConfig>(10, nlohmann::json::object());
+	auto cell = MapRingCell(0, config);
+	auto& atomic = static_cast<cadmium::AtomicInterface&>(cell);
+	auto inPort = std::dynamic_pointer_cast<cadmium::_BigPort<CellStateMessage<int, SIRState>>>(cell.getInPort("inputNeighborhood"));
+	std::vector<std::size_t> indices;
+	for (const auto& [neighbor, vicinity]: config->buildNeighbors(0)) {
+		indices.push_back(10 * neighbor);
+	}
+	cell.setIndices(0, indices);
+	// The flat neighborhood set falls back to the unordered map with the states of indexed and non-indexed senders
+	inPort->addMessage(9, population(1), 90);
+	inPort->addMessage(1, population(2));
+	inPort->addMessage(0, population(3), 0);
+	atomic.externalTransition(0);
+	BOOST_CHECK_EQUAL(cell.getState().p, 10 * 1 + 2 * 2 + 1 * 3);
+	// Further messages update the unordered map
+	inPort->clear();
+	inPort->addMessage(1, population(4), 10);
+	atomic.externalTransition(0);
+	BOOST_CHECK_EQUAL(cell.getState().p, 10 * 1 + 2 * 4 + 1 * 3);
+	// Messages from cells that are not neighbors throw
+	inPort->clear();
+	inPort->addMessage(5, population(1));
+	BOOST_CHECK_THROW(atomic.externalTransition(0), std::out_of_range);
+
+	// Cells must implement one of the local computation functions
+	auto noRule = NoRuleCell(0, config);
+	BOOST_CHECK_THROW(static_cast<cadmium::AtomicInterface&>(noRule).externalTransition(0), cadmium::CadmiumModelException);
+}
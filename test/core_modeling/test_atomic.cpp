@@ -160,3 +160,18 @@ BOOST_AUTO_TEST_CASE(AtomicTest)
 	BOOST_CHECK_EQUAL(3., state.sigma);
 	BOOST_CHECK_EQUAL(dummy1.logState(), "<3,3,3,3.5,3>");
 }
+
+BOOST_AUTO_TEST_CASE(AtomicStateSavingTest)
+{
+	auto dummy = DummyAtomic("dummy");
+	auto saved = dummy.saveState();
+	dummy.internalTransition();
+	dummy.internalTransition();
+	BOOST_CHECK_EQUAL(dummy.logState(), "<2,0,0,1,2>");
+	auto savedAgain = dummy.saveState();
+	dummy.restoreState(saved);
+	BOOST_CHECK_EQUAL(dummy.logState(), "<0,0,0,0,0>");
+	dummy.restoreState(savedAgain);
+	BOOST_CHECK_EQUAL(dummy.logState(), "<2,0,0,1,2>");
+	BOOST_CHECK_THROW(dummy.restoreState(std::any(0)), std::bad_any_cast);
+}
@@ -61,3 +61,38 @@ BOOST_AUTO_TEST_CASE(PortTest)
     port3Casted->clear();
     BOOST_CHECK(port3->empty());
 }
+
+BOOST_AUTO_TEST_CASE(PortSerializationTest)
+{
+    auto port1 = std::make_shared<_Port<int>>("port1");
+    port1->addMessage(1);
+    port1->addMessage(2);
+    auto port2 = std::make_shared<_Port<std::string>>("port2");
+    port2->addMessage("hello");
+    port2->addMessage("");
+    auto port3 = std::make_shared<_BigPort<std::string>>("port3");
+    port3->addMessage(std::string("big"));
+
+    std::vector<char> buffer;
+    port1->serialize(buffer);
+    port2->serialize(buffer);
+    port3->serialize(buffer);
+
+    auto port4 = port1->newCompatiblePort("port4");
+    auto port5 = port2->newCompatiblePort("port5");
+    auto port6 = port3->newCompatiblePort("port6");
+    const char* cursor = buffer.data();
+    const char* end = buffer.data() + buffer.size();
+    port4->deserialize(cursor, end);
+    port5->deserialize(cursor, end);
+    port6->deserialize(cursor, end);
+    BOOST_CHECK(cursor == end);
+    BOOST_CHECK(std::dynamic_pointer_cast<_Port<int>>(port4)->getBag() == port1->getBag());
+    BOOST_CHECK(std::dynamic_pointer_cast<_Port<std::string>>(port5)->getBag() == port2->getBag());
+    auto bag6 = std::dynamic_pointer_cast<_Port<std::shared_ptr<const std::string>>>(port6)->getBag();
+    BOOST_CHECK_EQUAL(1, bag6.size());
+    BOOST_CHECK(*bag6.at(0) == *port3->getBag().at(0));
+
+    cursor = buffer.data();
+    BOOST_CHECK_THROW(port4->deserialize(cursor, buffer.data() + 4), CadmiumModelException);
+}
@@ -0,0 +1,195 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#define BOOST_TEST_MODULE TimeTests
+#include <boost/test/unit_test.hpp>
+#include <cadmium/core/modeling/atomic.hpp>
+#include <cadmium/core/modeling/coupled.hpp>
+#include <cadmium/core/modeling/time.hpp>
+#include <cadmium/core/simulation/calendar_queue.hpp>
+#include <cadmium/core/simulation/calendar_root_coordinator.hpp>
+#include <cadmium/core/simulation/root_coordinator.hpp>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace cadmium;
+
+using Decimal = FixedPoint<10>;
+
+BOOST_AUTO_TEST_CASE(FixedPointTest)
+{
+	BOOST_CHECK_EQUAL(Decimal(0.1).getTicks(), 1);
+	BOOST_CHECK_EQUAL(Decimal(2).getTicks(), 20);
+	BOOST_CHECK_EQUAL(Decimal::fromTicks(3).toDouble(), 0.3);
+	BOOST_CHECK(Decimal(0.1) + Decimal(0.1) + Decimal(0.1) == Decimal(0.3));
+	BOOST_CHECK(Decimal(0.3) - Decimal(0.1) == Decimal(0.2));
+	BOOST_CHECK(Decimal(0.1) < Decimal(0.2));
+	BOOST_CHECK(Decimal() == TimeTraits<Decimal>::zero());
+
+	auto inf = TimeTraits<Decimal>::infinity();
+	BOOST_CHECK(inf.isInfinity());
+	BOOST_CHECK(Decimal(std::numeric_limits<double>::infinity()) == inf);
+	BOOST_CHECK(inf + Decimal(1) == inf);
+	BOOST_CHECK(inf - Decimal(1) == inf);
+	BOOST_CHECK(Decimal(1000) < inf);
+	BOOST_CHECK_EQUAL(TimeTraits<Decimal>::toDouble(inf), std::numeric_limits<double>::infinity());
+
+	BOOST_CHECK_EQUAL(TimeTraits<Decimal>::bucket(Decimal(0.5), Decimal(0.2)), 2);
+	BOOST_CHECK_EQUAL(TimeTraits<Decimal>::bucket(Decimal(-0.1), Decimal(0.2)), -1);
+	BOOST_CHECK_EQUAL(TimeTraits<double>::bucket(0.5, 0.2), 2);
+
+	std::stringstream ss("1.5");
+	Ticks t;
+	ss >> t;
+	BOOST_CHECK_EQUAL(t.getTicks(), 2);
+	ss.str("");
+	ss.clear();
+	ss << Decimal(2.5);
+	BOOST_CHECK_EQUAL(ss.str(), "2.5");
+}
+
+//! Generator that outputs its period every period time units.
+template <typename T>
+struct Generator: public Atomic<T, T> {
+	Port<T> out;
+	Generator(const std::string& id, T period): Atomic<T, T>(id, period) {
+		out = this->template addOutPort<T>("out");
+	}
+	void internalTransition(T& s) const override {}
+	void externalTransition(T& s, T e) const override {}
+	void output(const T& s) const override {
+		out->addMessage(s);
+	}
+	[[nodiscard]] T timeAdvance(const T& s) const override {
+		return s;
+	}
+};
+
+//! Number of simultaneous messages received by a collector.
+struct CollectorState {
+	int nSimultaneous;
+	CollectorState(): nSimultaneous() {}
+};
+
+std::ostream& operator<<(std::ostream& out, const CollectorState& s) {
+	return out << s.nSimultaneous;
+}
+
+//! Collector that counts how many times it receives messages from two generators at once.
+template <typename T>
+struct Collector: public Atomic<CollectorState, T> {
+	Port<T> in;
+	explicit Collector(const std::string& id): Atomic<CollectorState, T>(id, CollectorState()) {
+		in = this->template addInPort<T>("in");
+	}
+	void internalTransition(CollectorState& s) const override {}
+	void externalTransition(CollectorState& s, T e) const override {
+		s.nSimultaneous += (in->size() == 2) ? 1 : 0;
+	}
+	void output(const CollectorState& s) const override {}
+	[[nodiscard]] T timeAdvance(const CollectorState& s) const override {
+		return TimeTraits<T>::infinity();
+	}
+};
+
+//! Two generators with periods 0.1 and 0.3 and a collector. Their events coincide every 0.3 time units.
+template <typename T>
+struct Clocks: public Coupled {
+	std::shared_ptr<Collector<T>> collector;
+	explicit Clocks(const std::string& id): Coupled(id) {
+		auto fast = addComponent<Generator<T>>("fast", T(0.1));
+		auto slow = addComponent<Generator<T>>("slow", T(0.3));
+		collector = addComponent<Collector<T>>("collector");
+		addCoupling(fast->out, collector->in);
+		addCoupling(slow->out, collector->in);
+	}
+};
+
+BOOST_AUTO_TEST_CASE(FixedPointSimulationTest)
+{
+	auto model = std::make_shared<Clocks<Decimal>>("clocks");
+	auto rootCoordinator = BasicRootCoordinator<Decimal>(model);
+	rootCoordinator.start();
+	rootCoordinator.simulate(Decimal(3));
+	rootCoordinator.stop();
+	// Events coincide at 0.3, 0.6, ..., 2.7 (t = 3 is not simulated)
+	BOOST_CHECK_EQUAL(model->collector->logState(), "9");
+	BOOST_CHECK(rootCoordinator.getTopCoordinator()->getTimeLast() == Decimal(2.9));
+}
+
+BOOST_AUTO_TEST_CASE(MixedTimeTypesTest)
+{
+	auto model = std::make_shared<Clocks<Decimal>>("clocks");
+	BOOST_CHECK_THROW(RootCoordinator(model, 0.), CadmiumSimulationException);
+}
+
+BOOST_AUTO_TEST_CASE(CalendarQueueTest)
+{
+	auto queue = CalendarQueue<Ticks>(6, Ticks(2), 2);
+	std::vector<std::size_t> imminent;
+	BOOST_CHECK(queue.pop(imminent).isInfinity());
+	BOOST_CHECK(imminent.empty());
+
+	queue.schedule(0, Ticks(3));
+	queue.schedule(1, Ticks(1));
+	queue.schedule(2, Ticks(3));
+	queue.schedule(3, Ticks(20));  // a few years ahead of the others
+	queue.schedule(4, Ticks(1));
+	queue.schedule(4, Ticks(7));   // the previous event of model 4 becomes stale
+	queue.schedule(5, TimeTraits<Ticks>::infinity());
+	BOOST_CHECK_EQUAL(queue.size(), 5);
+	BOOST_CHECK_GT(queue.nBuckets(), 2);  // there were more than 2 events per bucket
+	BOOST_CHECK(queue.getTime(4) == Ticks(7));
+
+	BOOST_CHECK(queue.pop(imminent) == Ticks(1));
+	BOOST_CHECK_EQUAL(imminent.size(), 1);
+	BOOST_CHECK_EQUAL(imminent.at(0), 1);
+	BOOST_CHECK(queue.getTime(1).isInfinity());
+
+	imminent.clear();
+	BOOST_CHECK(queue.pop(imminent) == Ticks(3));
+	std::sort(imminent.begin(), imminent.end());
+	BOOST_CHECK_EQUAL(imminent.size(), 2);
+	BOOST_CHECK_EQUAL(imminent.at(0), 0);
+	BOOST_CHECK_EQUAL(imminent.at(1), 2);
+
+	queue.schedule(0, Ticks(3));  // rescheduling in the current bucket
+	imminent.clear();
+	BOOST_CHECK(queue.pop(imminent) == Ticks(3));
+	BOOST_CHECK_EQUAL(imminent.size(), 1);
+
+	for (auto expected: {7, 20}) {
+		imminent.clear();
+		BOOST_CHECK(queue.pop(imminent) == Ticks(expected));
+		BOOST_CHECK_EQUAL(imminent.size(), 1);
+	}
+	BOOST_CHECK_EQUAL(queue.size(), 0);
+	BOOST_CHECK(queue.nextTime().isInfinity());
+
+	BOOST_CHECK_EQUAL(queue.addElement(), 6);
+	queue.schedule(6, Ticks(30));
+	BOOST_CHECK(queue.getTime(6) == Ticks(30));
+	imminent.clear();
+	BOOST_CHECK(queue.pop(imminent) == Ticks(30));
+	BOOST_CHECK_EQUAL(imminent.at(0), 6);
+
+	BOOST_CHECK_THROW(CalendarQueue<double>(1, 0., 1), CadmiumSimulationException);
+	BOOST_CHECK_THROW(CalendarQueue<double>(1, 1., 0), CadmiumSimulationException);
+}
+
+BOOST_AUTO_TEST_CASE(FixedPointCalendarSimulationTest)
+{
+	auto model = std::make_shared<Clocks<Decimal>>("clocks");
+	auto rootCoordinator = BasicCalendarRootCoordinator<Decimal>(model, Decimal(0.1));
+	rootCoordinator.start();
+	rootCoordinator.simulate(Decimal(3));
+	rootCoordinator.stop();
+	BOOST_CHECK_EQUAL(model->collector->logState(), "9");
+}
@@ -0,0 +1,73 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#define BOOST_TEST_MODULE CalendarDEVStoneTests
+#include <boost/test/unit_test.hpp>
+#include <cadmium/core/simulation/calendar_root_coordinator.hpp>
+#include <cadmium/core/simulation/root_coordinator.hpp>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include "../../example/devstone/include/devstone.hpp"
+#include "../../example/devstone/include/devstone_atomic.hpp"
+
+#define STEP 7
+#define MAX_WIDTH 15
+#define MAX_DEPTH 15
+
+using namespace cadmium::example::devstone;
+
+/**
+ * It counts the events triggered by all the DEVStone atomic models of a model.
+ * Flattening breaks the counters of DEVStone coupled models, so we traverse the model tree instead.
+ * @param coupled pointer to the coupled model.
+ * @return tuple <number of internal transitions, number of external transitions, number of events>.
+ */
+std::tuple<int, int, int> countEvents(const std::shared_ptr<cadmium::Coupled>& coupled) {
+	int nInternals = 0, nExternals = 0, nEvents = 0;
+	for (const auto& [componentId, component]: coupled->getComponents()) {
+		auto atomic = std::dynamic_pointer_cast<DEVStoneAtomic>(component);
+		if (atomic != nullptr) {
+			nInternals += atomic->nInternals();
+			nExternals += atomic->nExternals();
+			nEvents += atomic->nEvents();
+		}
+		auto child = std::dynamic_pointer_cast<cadmium::Coupled>(component);
+		if (child != nullptr) {
+			auto [i, e, n] = countEvents(child);
+			nInternals += i;
+			nExternals += e;
+			nEvents += n;
+		}
+	}
+	return {nInternals, nExternals, nEvents};
+}
+
+//! It checks that the calendar root coordinator triggers the same events as the sequential one.
+BOOST_AUTO_TEST_CASE(CalendarDEVStone)
+{
+	for (const auto& type: {"LI", "HI", "HO", "HOmod"}) {
+		for (int w = 1; w <= MAX_WIDTH; w += STEP) {
+			for (int d = 1; d <= MAX_DEPTH; d += STEP) {
+				auto expected = std::make_shared<DEVStone>(type, w, d, 0, 0);
+				auto rootCoordinator = cadmium::RootCoordinator(expected);
+				rootCoordinator.start();
+				rootCoordinator.simulate(std::numeric_limits<double>::infinity());
+				rootCoordinator.stop();
+
+				auto coupled = std::make_shared<DEVStone>(type, w, d, 0, 0);
+				auto calendar = cadmium::CalendarRootCoordinator(coupled, 1.);
+				calendar.start();
+				calendar.simulate(std::numeric_limits<double>::infinity());
+				calendar.stop();
+				auto [nInternals, nExternals, nEvents] = countEvents(coupled);
+				BOOST_CHECK_EQUAL(nInternals, expected->nInternals());
+				BOOST_CHECK_EQUAL(nExternals, expected->nExternals());
+				BOOST_CHECK_EQUAL(nEvents, expected->nEvents());
+			}
+		}
+	}
+}
@@ -0,0 +1,354 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#define BOOST_TEST_MODULE ParallelDEVStoneTests
+#include <boost/test/unit_test.hpp>
+#include <cadmium/core/logger/logger.hpp>
+#include <cadmium/core/simulation/conservative_root_coordinator.hpp>
+#include <cadmium/core/simulation/parallel_hierarchical_root_coordinator.hpp>
+#include <cadmium/core/simulation/parallel_root_coordinator.hpp>
+#include <cadmium/core/simulation/root_coordinator.hpp>
+#include <cadmium/core/simulation/time_warp_root_coordinator.hpp>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "../../example/devstone/include/devstone.hpp"
+#include "../../example/devstone/include/devstone_atomic.hpp"
+
+#define STEP 7
+#define MAX_WIDTH 15
+#define MAX_DEPTH 15
+#define N_THREADS 4
+
+using namespace cadmium::example::devstone;
+
+/**
+ * It counts the events triggered by all the DEVStone atomic models of a model.
+ * Flattening breaks the counters of DEVStone coupled models, so we traverse the model tree instead.
+ * @param coupled pointer to the coupled model.
+ * @return tuple <number of internal transitions, number of external transitions, number of events>.
+ */
+std::tuple<int, int, int> countEvents(const std::shared_ptr<cadmium::Coupled>& coupled) {
+	int nInternals = 0, nExternals = 0, nEvents = 0;
+	for (const auto& [componentId, component]: coupled->getComponents()) {
+		auto atomic = std::dynamic_pointer_cast<DEVStoneAtomic>(component);
+		if (atomic != nullptr) {
+			nInternals += atomic->nInternals();
+			nExternals += atomic->nExternals();
+			nEvents += atomic->nEvents();
+		}
+		auto child = std::dynamic_pointer_cast<cadmium::Coupled>(component);
+		if (child != nullptr) {
+			auto [i, e, n] = countEvents(child);
+			nInternals += i;
+			nExternals += e;
+			nEvents += n;
+		}
+	}
+	return {nInternals, nExternals, nEvents};
+}
+
+//! It checks that a parallel simulation of a DEVStone model triggers the same events as a sequential one.
+template <typename F>
+void checkParallelDEVStone(const std::string& type, int width, int depth, F&& parallelSimulation) {
+	auto expected = std::make_shared<DEVStone>(type, width, depth, 0, 0);
+	auto rootCoordinator = cadmium::RootCoordinator(expected);
+	rootCoordinator.start();
+	rootCoordinator.simulate(std::numeric_limits<double>::infinity());
+	rootCoordinator.stop();
+
+	auto coupled = std::make_shared<DEVStone>(type, width, depth, 0, 0);
+	parallelSimulation(coupled);
+	auto [nInternals, nExternals, nEvents] = countEvents(coupled);
+	BOOST_CHECK_EQUAL(nInternals, expected->nInternals());
+	BOOST_CHECK_EQUAL(nExternals, expected->nExternals());
+	BOOST_CHECK_EQUAL(nEvents, expected->nEvents());
+}
+
+template <typename F>
+void checkParallelDEVStone(F&& parallelSimulation) {
+	for (const auto& type: {"LI", "HI", "HO", "HOmod"}) {
+		for (int w = 1; w <= MAX_WIDTH; w += STEP) {
+			for (int d = 1; d <= MAX_DEPTH; d += STEP) {
+				checkParallelDEVStone(type, w, d, parallelSimulation);
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ParallelDEVStone)
+{
+	checkParallelDEVStone([](const std::shared_ptr<DEVStone>& coupled) {
+		auto coordinator = cadmium::ParallelRootCoordinator(coupled);
+		coordinator.start();
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+		coordinator.stop();
+	});
+}
+
+BOOST_AUTO_TEST_CASE(ParallelDEVStoneRelocated)
+{
+	checkParallelDEVStone([](const std::shared_ptr<DEVStone>& coupled) {
+		auto coordinator = cadmium::ParallelRootCoordinator(coupled);
+		coordinator.setAffinity({0});
+		coordinator.start();
+		coordinator.relocate(N_THREADS);
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+		coordinator.stop();
+	});
+}
+
+BOOST_AUTO_TEST_CASE(ParallelDEVStoneTyped)
+{
+	checkParallelDEVStone([](const std::shared_ptr<DEVStone>& coupled) {
+		auto coordinator = cadmium::ParallelRootCoordinator(coupled);
+		coordinator.registerAtomicType<DEVStoneAtomic>();
+		coordinator.start();
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+		coordinator.stop();
+	});
+}
+
+BOOST_AUTO_TEST_CASE(ParallelDEVStoneSerialSteps)
+{
+	checkParallelDEVStone([](const std::shared_ptr<DEVStone>& coupled) {
+		auto coordinator = cadmium::ParallelRootCoordinator(coupled);
+		coordinator.setSerialThreshold(MAX_WIDTH);
+		coordinator.start();
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+		coordinator.stop();
+	});
+}
+
+BOOST_AUTO_TEST_CASE(ParallelDEVStoneZeroTimeCascade)
+{
+	checkParallelDEVStone([](const std::shared_ptr<DEVStone>& coupled) {
+		auto coordinator = cadmium::ParallelRootCoordinator(coupled);
+		coordinator.setZeroTimeCascade(true);
+		coordinator.start();
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+		coordinator.stop();
+	});
+	checkParallelDEVStone([](const std::shared_ptr<DEVStone>& coupled) {
+		auto coordinator = cadmium::ParallelRootCoordinator(coupled);
+		coordinator.setZeroTimeCascade(true);
+		coordinator.setSerialThreshold(MAX_WIDTH);
+		coordinator.start();
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+		coordinator.stop();
+	});
+}
+
+BOOST_AUTO_TEST_CASE(ParallelDEVStonePushRouting)
+{
+	checkParallelDEVStone([](const std::shared_ptr<DEVStone>& coupled) {
+		auto coordinator = cadmium::ParallelRootCoordinator(coupled);
+		coordinator.start();
+		coordinator.simulatePushRouting(std::numeric_limits<double>::infinity(), N_THREADS);
+		coordinator.stop();
+	});
+}
+
+//! Logger that keeps the simulation time of every step and the simulation time and model name of every state transition.
+class TransitionLogger : public cadmium::Logger {
+ private:
+	std::vector<double> steps;                                //!< simulation time of every step.
+	std::vector<std::pair<double, std::string>> transitions;  //!< simulation time and model of every transition.
+ public:
+	void start() override {}
+	void stop() override {}
+	void logTime(double time) override {
+		steps.push_back(time);
+	}
+	void logOutput(double, long, const std::string&, const std::string&, const std::string&) override {}
+	void logState(double time, long, const std::string& modelName, const std::string&) override {
+		transitions.emplace_back(time, modelName);
+	}
+
+	//! @return the simulation time of every logged step.
+	[[nodiscard]] const std::vector<double>& getSteps() const {
+		return steps;
+	}
+
+	//! @return the logged transitions sorted by simulation time and model name.
+	[[nodiscard]] std::vector<std::pair<double, std::string>> sorted() const {
+		auto res = transitions;
+		std::sort(res.begin(), res.end());
+		return res;
+	}
+};
+
+//! It checks that push routing triggers every transition at the same simulation time as a sequential simulation.
+BOOST_AUTO_TEST_CASE(ParallelDEVStonePushRoutingTransitions)
+{
+	for (const auto& type: {"LI", "HI", "HO", "HOmod"}) {
+		for (int w = 1; w <= MAX_WIDTH; w += STEP) {
+			for (int d = 1; d <= MAX_DEPTH; d += STEP) {
+				auto expectedLogger = std::make_shared<TransitionLogger>();
+				auto rootCoordinator = cadmium::RootCoordinator(std::make_shared<DEVStone>(type, w, d, 0, 0));
+				rootCoordinator.setLogger(expectedLogger);
+				rootCoordinator.start();
+				rootCoordinator.simulate(std::numeric_limits<double>::infinity());
+				rootCoordinator.stop();
+
+				auto logger = std::make_shared<TransitionLogger>();
+				auto coordinator = cadmium::ParallelRootCoordinator(std::make_shared<DEVStone>(type, w, d, 0, 0));
+				coordinator.setLogger(logger);
+				coordinator.start();
+				coordinator.simulatePushRouting(std::numeric_limits<double>::infinity(), N_THREADS);
+				coordinator.stop();
+				BOOST_CHECK(logger->sorted() == expectedLogger->sorted());
+			}
+		}
+	}
+}
+
+//! It checks that the next time reduction still follows the simulators after they are regrouped and relocated.
+BOOST_AUTO_TEST_CASE(ParallelDEVStoneTypedRelocatedSteps)
+{
+	for (const auto& type: {"LI", "HI", "HO", "HOmod"}) {
+		for (int w = 1; w <= MAX_WIDTH; w += STEP) {
+			for (int d = 1; d <= MAX_DEPTH; d += STEP) {
+				auto expectedLogger = std::make_shared<TransitionLogger>();
+				auto rootCoordinator = cadmium::RootCoordinator(std::make_shared<DEVStone>(type, w, d, 0, 0));
+				rootCoordinator.setLogger(expectedLogger);
+				rootCoordinator.start();
+				rootCoordinator.simulate(std::numeric_limits<double>::infinity());
+				rootCoordinator.stop();
+
+				// Deterministic mode logs the time of every step, as the sequential root coordinator does
+				auto logger = std::make_shared<TransitionLogger>();
+				auto coordinator = cadmium::ParallelRootCoordinator(std::make_shared<DEVStone>(type, w, d, 0, 0));
+				coordinator.setLogger(logger);
+				coordinator.setDeterministic(true);
+				coordinator.registerAtomicType<DEVStoneAtomic>();
+				coordinator.start();
+				coordinator.relocate(N_THREADS);
+				coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+				coordinator.stop();
+				BOOST_CHECK(logger->getSteps() == expectedLogger->getSteps());
+				BOOST_CHECK(logger->sorted() == expectedLogger->sorted());
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ParallelHierarchicalDEVStone)
+{
+	checkParallelDEVStone([](const std::shared_ptr<DEVStone>& coupled) {
+		auto coordinator = cadmium::ParallelHierarchicalRootCoordinator(coupled);
+		coordinator.start();
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+		coordinator.stop();
+	});
+}
+
+BOOST_AUTO_TEST_CASE(TimeWarpDEVStone)
+{
+	checkParallelDEVStone([](const std::shared_ptr<DEVStone>& coupled) {
+		auto coordinator = cadmium::TimeWarpRootCoordinator(coupled);
+		coordinator.setGVTPeriod(50);
+		coordinator.start();
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+		coordinator.stop();
+	});
+}
+
+//! State of the faulty model of the Time Warp exception tests.
+struct FaultyState {
+	double clock;
+	bool received;
+	FaultyState(): clock(), received() {}
+};
+
+std::ostream& operator<<(std::ostream& os, const FaultyState& s) {
+	os << "<" << s.clock << "," << s.received << ">";
+	return os;
+}
+
+//! Atomic model that ticks every time unit. Its fifth tick throws an exception if it has not received any message yet.
+struct Faulty: public cadmium::Atomic<FaultyState> {
+	cadmium::Port<int> in;
+	explicit Faulty(const std::string& id): cadmium::Atomic<FaultyState>(id, FaultyState()) {
+		in = addInPort<int>("in");
+	}
+	const FaultyState& getState() {
+		return state;
+	}
+	void internalTransition(FaultyState& s) const override {
+		s.clock += 1;
+		if (s.clock >= 5 && !s.received) {
+			throw cadmium::CadmiumModelException("faulty model did not receive any message");
+		}
+	}
+	void externalTransition(FaultyState& s, double e) const override {
+		s.clock += e;
+		s.received = true;
+	}
+	void output(const FaultyState&) const override {}
+	[[nodiscard]] double timeAdvance(const FaultyState& s) const override {
+		return (s.clock < 10) ? 1 : std::numeric_limits<double>::infinity();
+	}
+};
+
+//! Atomic model that sends one message at time 4. Its output function is slow, so its receiver runs ahead.
+struct SlowSender: public cadmium::Atomic<double> {
+	cadmium::Port<int> out;
+	explicit SlowSender(const std::string& id): cadmium::Atomic<double>(id, 4) {
+		out = addOutPort<int>("out");
+	}
+	void internalTransition(double& sigma) const override {
+		sigma = std::numeric_limits<double>::infinity();
+	}
+	void externalTransition(double&, double) const override {}
+	void output(const double&) const override {
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		out->addMessage(1);
+	}
+	[[nodiscard]] double timeAdvance(const double& sigma) const override {
+		return sigma;
+	}
+};
+
+//! It checks that Time Warp discards the exceptions of events undone by stragglers and rethrows the rest.
+BOOST_AUTO_TEST_CASE(TimeWarpSpeculativeException)
+{
+	for (bool coupled: {true, false}) {
+		auto model = std::make_shared<cadmium::Coupled>("model");
+		auto faulty = model->addComponent<Faulty>("faulty");
+		auto sender = model->addComponent<SlowSender>("sender");
+		if (coupled) {
+			model->addCoupling(sender->out, faulty->in);
+		}
+		auto coordinator = cadmium::TimeWarpRootCoordinator(model);
+		coordinator.start();
+		if (coupled) {
+			// The faulty model fails at time 5 before the message of time 4 arrives
+			BOOST_CHECK_NO_THROW(coordinator.simulate(std::numeric_limits<double>::infinity(), 2));
+			BOOST_CHECK(faulty->getState().received);
+			BOOST_CHECK_EQUAL(faulty->getState().clock, 10);
+		} else {
+			BOOST_CHECK_THROW(coordinator.simulate(std::numeric_limits<double>::infinity(), 2), cadmium::CadmiumModelException);
+		}
+		coordinator.stop();
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ConservativeDEVStone)
+{
+	checkParallelDEVStone([](const std::shared_ptr<DEVStone>& coupled) {
+		auto coordinator = cadmium::ConservativeRootCoordinator(coupled);
+		coordinator.start();
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+		coordinator.stop();
+	});
+}
@@ -0,0 +1,132 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#define BOOST_TEST_MODULE DistributedEFPGPTTests
+#include <boost/test/unit_test.hpp>
+#include <cadmium/core/logger/logger.hpp>
+#include <cadmium/core/simulation/distributed_root_coordinator.hpp>
+#include <cadmium/core/simulation/root_coordinator.hpp>
+#include <cadmium/core/transport/unix_socket.hpp>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../../example/efp_gpt/include/efp.hpp"
+#include "../../example/efp_gpt/include/gpt.hpp"
+
+using namespace cadmium::example::gpt;
+
+//! Logger that keeps all the log entries in memory.
+class MemoryLogger: public cadmium::Logger {
+ public:
+	std::vector<std::string> entries;
+
+	MemoryLogger(): cadmium::Logger(), entries() {}
+
+	void start() override {}
+
+	void stop() override {}
+
+	void logTime(double time) override {
+		std::stringstream ss;
+		ss << "time;" << time;
+		entries.push_back(ss.str());
+	}
+
+	void logOutput(double time, long modelId, const std::string& modelName, const std::string& portName, const std::string& output) override {
+		std::stringstream ss;
+		ss << time << ";" << modelId << ";" << modelName << ";" << portName << ";" << output;
+		entries.push_back(ss.str());
+	}
+
+	void logState(double time, long modelId, const std::string& modelName, const std::string& state) override {
+		std::stringstream ss;
+		ss << time << ";" << modelId << ";" << modelName << ";;" << state;
+		entries.push_back(ss.str());
+	}
+};
+
+/**
+ * It merges the logs of all the processes. Processes simulate models with consecutive IDs,
+ * so we only need to concatenate the entries of every process step by step.
+ */
+std::vector<std::string> mergeLogs(const std::vector<std::vector<std::string>>& logs) {
+	std::vector<std::vector<std::vector<std::string>>> steps(logs.size());
+	for (std::size_t rank = 0; rank < logs.size(); ++rank) {
+		steps[rank].emplace_back();
+		for (const auto& entry: logs[rank]) {
+			if (entry.rfind("time;", 0) == 0) {
+				steps[rank].emplace_back();
+			}
+			steps[rank].back().push_back(entry);
+		}
+	}
+	std::vector<std::string> merged;
+	for (std::size_t step = 0; step < steps[0].size(); ++step) {
+		for (std::size_t rank = 0; rank < logs.size(); ++rank) {
+			BOOST_REQUIRE_EQUAL(steps[rank].size(), steps[0].size());
+			// Only the first process keeps the time entry of the step
+			auto begin = steps[rank][step].begin() + ((rank > 0 && step > 0) ? 1 : 0);
+			merged.insert(merged.end(), begin, steps[rank][step].end());
+		}
+	}
+	return merged;
+}
+
+//! It checks that a distributed simulation logs exactly the same as a sequential simulation.
+template <typename M>
+void checkDistributedLogs(int nProcesses, double jobPeriod, double processingTime, double obsTime) {
+	auto expectedLogger = std::make_shared<MemoryLogger>();
+	auto expected = std::make_shared<M>("model", jobPeriod, processingTime, obsTime);
+	expected->flatten();  // Distributed coordinators flatten the model, so model IDs only match with flat models
+	auto rootCoordinator = cadmium::RootCoordinator(expected);
+	rootCoordinator.setLogger(expectedLogger);
+	rootCoordinator.start();
+	rootCoordinator.simulate(std::numeric_limits<double>::infinity());
+
+	auto transport = cadmium::UnixSocketTransport::fork(nProcesses);
+	std::vector<std::vector<char>> incoming;
+	try {
+		auto logger = std::make_shared<MemoryLogger>();
+		auto coordinator = cadmium::DistributedRootCoordinator(std::make_shared<M>("model", jobPeriod, processingTime, obsTime), transport);
+		coordinator.setLogger(logger);
+		coordinator.start();
+		coordinator.simulate(std::numeric_limits<double>::infinity());
+		// Every process sends its log entries to the first process
+		std::vector<std::vector<char>> outgoing(nProcesses);
+		cadmium::Serializer<std::vector<std::string>>::write(outgoing[0], logger->entries);
+		incoming = transport->allToAll(std::move(outgoing));
+	} catch (...) {
+		if (transport->getRank() != 0) {
+			std::_Exit(EXIT_FAILURE);
+		}
+		throw;
+	}
+	// Child processes must not return to the test framework
+	if (transport->getRank() != 0) {
+		std::_Exit(EXIT_SUCCESS);
+	}
+
+	std::vector<std::vector<std::string>> logs;
+	for (const auto& buffer: incoming) {
+		const char* cursor = buffer.data();
+		logs.push_back(cadmium::Serializer<std::vector<std::string>>::read(cursor, buffer.data() + buffer.size()));
+	}
+	auto merged = mergeLogs(logs);
+	BOOST_CHECK_EQUAL_COLLECTIONS(merged.begin(), merged.end(), expectedLogger->entries.begin(), expectedLogger->entries.end());
+}
+
+BOOST_AUTO_TEST_CASE(DistributedEFPGPT)
+{
+	for (int nProcesses: {1, 2, 3}) {
+		for (const auto& [jobPeriod, processingTime]: std::vector<std::pair<double, double>>{{1, 3}, {3, 1}, {2, 2}, {0.5, 0}}) {
+			checkDistributedLogs<EFP>(nProcesses, jobPeriod, processingTime, 100);
+			checkDistributedLogs<GPT>(nProcesses, jobPeriod, processingTime, 100);
+		}
+	}
+}
@@ -0,0 +1,314 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#define BOOST_TEST_MODULE ParallelEFPGPTTests
+#include <boost/test/unit_test.hpp>
+#include <cadmium/core/logger/logger.hpp>
+#include <cadmium/core/simulation/conservative_root_coordinator.hpp>
+#include <cadmium/core/simulation/ensemble.hpp>
+#include <cadmium/core/simulation/parallel_root_coordinator.hpp>
+#include <cadmium/core/simulation/root_coordinator.hpp>
+#include <cadmium/core/simulation/time_warp_root_coordinator.hpp>
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../../example/efp_gpt/include/efp.hpp"
+#include "../../example/efp_gpt/include/gpt.hpp"
+
+#define N_THREADS 4
+
+using namespace cadmium::example::gpt;
+
+//! Logger that keeps all the log entries in memory.
+class MemoryLogger: public cadmium::Logger {
+ public:
+	std::vector<std::string> entries;
+
+	MemoryLogger(): cadmium::Logger(), entries() {}
+
+	void start() override {}
+
+	void stop() override {}
+
+	void logTime(double time) override {
+		std::stringstream ss;
+		ss << "time;" << time;
+		entries.push_back(ss.str());
+	}
+
+	void logOutput(double time, long modelId, const std::string& modelName, const std::string& portName, const std::string& output) override {
+		std::stringstream ss;
+		ss << time << ";" << modelId << ";" << modelName << ";" << portName << ";" << output;
+		entries.push_back(ss.str());
+	}
+
+	void logState(double time, long modelId, const std::string& modelName, const std::string& state) override {
+		std::stringstream ss;
+		ss << time << ";" << modelId << ";" << modelName << ";;" << state;
+		entries.push_back(ss.str());
+	}
+};
+
+//! It checks that a parallel simulation logs exactly the same as a sequential simulation.
+template <typename M, typename C, typename F>
+void checkParallelLogs(F&& parallelSimulation, double jobPeriod, double processingTime, double obsTime) {
+	auto expectedLogger = std::make_shared<MemoryLogger>();
+	auto expected = std::make_shared<M>("model", jobPeriod, processingTime, obsTime);
+	expected->flatten();  // Parallel coordinators flatten the model, so model IDs only match with flat models
+	auto rootCoordinator = cadmium::RootCoordinator(expected);
+	rootCoordinator.setLogger(expectedLogger);
+	rootCoordinator.start();
+	rootCoordinator.simulate(std::numeric_limits<double>::infinity());
+
+	auto logger = std::make_shared<MemoryLogger>();
+	auto parallelCoordinator = C(std::make_shared<M>("model", jobPeriod, processingTime, obsTime));
+	parallelCoordinator.setLogger(logger);
+	parallelCoordinator.start();
+	parallelSimulation(parallelCoordinator);
+
+	BOOST_CHECK_EQUAL_COLLECTIONS(logger->entries.begin(), logger->entries.end(), expectedLogger->entries.begin(), expectedLogger->entries.end());
+}
+
+BOOST_AUTO_TEST_CASE(TimeWarpEFPGPT)
+{
+	auto simulation = [](cadmium::TimeWarpRootCoordinator& coordinator) {
+		coordinator.setGVTPeriod(5);
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+	};
+	for (const auto& [jobPeriod, processingTime]: std::vector<std::pair<double, double>>{{1, 3}, {3, 1}, {2, 2}, {0.5, 0}}) {
+		checkParallelLogs<EFP, cadmium::TimeWarpRootCoordinator>(simulation, jobPeriod, processingTime, 100);
+		checkParallelLogs<GPT, cadmium::TimeWarpRootCoordinator>(simulation, jobPeriod, processingTime, 100);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ConservativeEFPGPT)
+{
+	auto simulation = [](cadmium::ConservativeRootCoordinator& coordinator) {
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+	};
+	for (const auto& [jobPeriod, processingTime]: std::vector<std::pair<double, double>>{{1, 3}, {3, 1}, {2, 2}, {0.5, 0}}) {
+		checkParallelLogs<EFP, cadmium::ConservativeRootCoordinator>(simulation, jobPeriod, processingTime, 100);
+		checkParallelLogs<GPT, cadmium::ConservativeRootCoordinator>(simulation, jobPeriod, processingTime, 100);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(DeterministicEFPGPT)
+{
+	auto simulation = [](cadmium::ParallelRootCoordinator& coordinator) {
+		coordinator.setDeterministic(true);
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+	};
+	auto serialCollection = [](cadmium::ParallelRootCoordinator& coordinator) {
+		coordinator.setDeterministic(true);
+		coordinator.simulateSerialCollection(std::numeric_limits<double>::infinity(), N_THREADS);
+	};
+	auto pushRouting = [](cadmium::ParallelRootCoordinator& coordinator) {
+		coordinator.setDeterministic(true);
+		coordinator.simulatePushRouting(std::numeric_limits<double>::infinity(), N_THREADS);
+	};
+	for (const auto& [jobPeriod, processingTime]: std::vector<std::pair<double, double>>{{1, 3}, {3, 1}, {2, 2}, {0.5, 0}}) {
+		checkParallelLogs<EFP, cadmium::ParallelRootCoordinator>(simulation, jobPeriod, processingTime, 100);
+		checkParallelLogs<GPT, cadmium::ParallelRootCoordinator>(simulation, jobPeriod, processingTime, 100);
+		checkParallelLogs<EFP, cadmium::ParallelRootCoordinator>(serialCollection, jobPeriod, processingTime, 100);
+		checkParallelLogs<GPT, cadmium::ParallelRootCoordinator>(serialCollection, jobPeriod, processingTime, 100);
+		checkParallelLogs<EFP, cadmium::ParallelRootCoordinator>(pushRouting, jobPeriod, processingTime, 100);
+		checkParallelLogs<GPT, cadmium::ParallelRootCoordinator>(pushRouting, jobPeriod, processingTime, 100);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(SerialStepsEFPGPT)
+{
+	auto fixed = [](cadmium::ParallelRootCoordinator& coordinator) {
+		coordinator.setDeterministic(true);
+		coordinator.setSerialThreshold(2);  // Steps alternate between serial and parallel execution
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+	};
+	auto adaptive = [](cadmium::ParallelRootCoordinator& coordinator) {
+		coordinator.setDeterministic(true);
+		coordinator.setAdaptiveSerialThreshold(true);
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+	};
+	for (const auto& [jobPeriod, processingTime]: std::vector<std::pair<double, double>>{{1, 3}, {3, 1}, {2, 2}, {0.5, 0}}) {
+		checkParallelLogs<EFP, cadmium::ParallelRootCoordinator>(fixed, jobPeriod, processingTime, 100);
+		checkParallelLogs<GPT, cadmium::ParallelRootCoordinator>(fixed, jobPeriod, processingTime, 100);
+		checkParallelLogs<EFP, cadmium::ParallelRootCoordinator>(adaptive, jobPeriod, processingTime, 100);
+		checkParallelLogs<GPT, cadmium::ParallelRootCoordinator>(adaptive, jobPeriod, processingTime, 100);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(ZeroTimeCascadeEFPGPT)
+{
+	auto parallel = [](cadmium::ParallelRootCoordinator& coordinator) {
+		coordinator.setDeterministic(true);
+		coordinator.setZeroTimeCascade(true);
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+	};
+	auto serial = [](cadmium::ParallelRootCoordinator& coordinator) {
+		coordinator.setDeterministic(true);
+		coordinator.setZeroTimeCascade(true);
+		coordinator.setSerialThreshold(2);
+		coordinator.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+	};
+	for (const auto& [jobPeriod, processingTime]: std::vector<std::pair<double, double>>{{1, 3}, {3, 1}, {2, 2}, {0.5, 0}}) {
+		checkParallelLogs<EFP, cadmium::ParallelRootCoordinator>(parallel, jobPeriod, processingTime, 100);
+		checkParallelLogs<GPT, cadmium::ParallelRootCoordinator>(parallel, jobPeriod, processingTime, 100);
+		checkParallelLogs<EFP, cadmium::ParallelRootCoordinator>(serial, jobPeriod, processingTime, 100);
+		checkParallelLogs<GPT, cadmium::ParallelRootCoordinator>(serial, jobPeriod, processingTime, 100);
+	}
+}
+
+//! Coupled model with several independent replicas of the GPT model. Atomic models have unique IDs.
+struct ReplicatedGPT: public cadmium::Coupled {
+	ReplicatedGPT(const std::string& id, int nReplicas): cadmium::Coupled(id) {
+		for (int i = 0; i < nReplicas; ++i) {
+			auto suffix = std::to_string(i);
+			auto generator = addComponent<Generator>("generator" + suffix, i + 1);
+			auto processor = addComponent<Processor>("processor" + suffix, i + 2);
+			auto transducer = addComponent<Transducer>("transducer" + suffix, 50);
+			addCoupling(generator->outGenerated, processor->inGenerated);
+			addCoupling(generator->outGenerated, transducer->inGenerated);
+			addCoupling(processor->outProcessed, transducer->inProcessed);
+			addCoupling(transducer->outStop, generator->inStop);
+		}
+	}
+};
+
+BOOST_AUTO_TEST_CASE(ClusteredGPT)
+{
+	auto expectedLogger = std::make_shared<MemoryLogger>();
+	auto expected = std::make_shared<ReplicatedGPT>("model", 3);
+	expected->flatten();
+	auto rootCoordinator = cadmium::RootCoordinator(expected);
+	rootCoordinator.setLogger(expectedLogger);
+	rootCoordinator.start();
+	rootCoordinator.simulate(std::numeric_limits<double>::infinity());
+
+	auto logger = std::make_shared<MemoryLogger>();
+	auto parallelCoordinator = cadmium::ParallelRootCoordinator(std::make_shared<ReplicatedGPT>("model", 3));
+	BOOST_CHECK_EQUAL(3, parallelCoordinator.getClusters().size());
+	for (const auto& cluster: parallelCoordinator.getClusters()) {
+		BOOST_CHECK_EQUAL(3, cluster.size());
+	}
+	parallelCoordinator.setLogger(logger);
+	parallelCoordinator.start();
+	parallelCoordinator.simulateClusters(std::numeric_limits<double>::infinity(), N_THREADS);
+
+	// Clusters log their entries in any order, and there are no time entries
+	auto& expectedEntries = expectedLogger->entries;
+	expectedEntries.erase(std::remove_if(expectedEntries.begin(), expectedEntries.end(), [](const auto& entry) {
+		return entry.rfind("time;", 0) == 0;
+	}), expectedEntries.end());
+	std::sort(expectedEntries.begin(), expectedEntries.end());
+	std::sort(logger->entries.begin(), logger->entries.end());
+	BOOST_CHECK_EQUAL_COLLECTIONS(logger->entries.begin(), logger->entries.end(), expectedEntries.begin(), expectedEntries.end());
+}
+
+BOOST_AUTO_TEST_CASE(DeterministicClusteredGPT)
+{
+	auto expectedLogger = std::make_shared<MemoryLogger>();
+	auto expected = std::make_shared<ReplicatedGPT>("model", 3);
+	expected->flatten();
+	auto rootCoordinator = cadmium::RootCoordinator(expected);
+	rootCoordinator.setLogger(expectedLogger);
+	rootCoordinator.start();
+	rootCoordinator.simulate(std::numeric_limits<double>::infinity());
+
+	// In deterministic mode, the logs of all the clusters are merged as in a sequential simulation
+	auto logger = std::make_shared<MemoryLogger>();
+	auto parallelCoordinator = cadmium::ParallelRootCoordinator(std::make_shared<ReplicatedGPT>("model", 3));
+	parallelCoordinator.setLogger(logger);
+	parallelCoordinator.setDeterministic(true);
+	parallelCoordinator.start();
+	parallelCoordinator.simulateClusters(std::numeric_limits<double>::infinity(), N_THREADS);
+	BOOST_CHECK_EQUAL_COLLECTIONS(logger->entries.begin(), logger->entries.end(), expectedLogger->entries.begin(), expectedLogger->entries.end());
+}
+
+BOOST_AUTO_TEST_CASE(EnsembleGPT)
+{
+	std::vector<std::pair<double, double>> params{{1, 3}, {3, 1}, {2, 2}, {0.5, 0}};
+	std::vector<std::shared_ptr<MemoryLogger>> loggers;
+	for (std::size_t i = 0; i < params.size(); ++i) {
+		loggers.push_back(std::make_shared<MemoryLogger>());
+	}
+	auto modelFactory = [&params](std::size_t i) -> std::shared_ptr<cadmium::Coupled> {
+		return std::make_shared<GPT>("model", params[i].first, params[i].second, 100);
+	};
+	auto transducerState = [](std::size_t i, const std::shared_ptr<cadmium::Coupled>& model) {
+		return std::dynamic_pointer_cast<cadmium::AtomicInterface>(model->getComponent("transducer"))->logState();
+	};
+	auto ensemble = cadmium::Ensemble<std::string>(modelFactory, transducerState, params.size());
+	ensemble.setLoggerFactory([&loggers](std::size_t i) -> std::shared_ptr<cadmium::Logger> {
+		return loggers[i];
+	});
+	auto results = ensemble.simulate(std::numeric_limits<double>::infinity(), N_THREADS);
+	BOOST_CHECK_EQUAL(params.size(), results.size());
+
+	for (std::size_t i = 0; i < params.size(); ++i) {
+		auto expectedLogger = std::make_shared<MemoryLogger>();
+		auto expected = std::make_shared<GPT>("model", params[i].first, params[i].second, 100);
+		auto rootCoordinator = cadmium::RootCoordinator(expected);
+		rootCoordinator.setLogger(expectedLogger);
+		rootCoordinator.start();
+		rootCoordinator.simulate(std::numeric_limits<double>::infinity());
+		rootCoordinator.stop();
+		BOOST_CHECK_EQUAL(transducerState(i, expected), results[i]);
+		BOOST_CHECK_EQUAL_COLLECTIONS(loggers[i]->entries.begin(), loggers[i]->entries.end(), expectedLogger->entries.begin(), expectedLogger->entries.end());
+	}
+}
+
+//! Atomic model that throws an exception when it receives its fifth job.
+class FaultyProcessor: public cadmium::Atomic<int> {
+ public:
+	cadmium::BigPort<Job> inGenerated;
+
+	explicit FaultyProcessor(const std::string& id): cadmium::Atomic<int>(id, 0) {
+		inGenerated = addInBigPort<Job>("inGenerated");
+	}
+
+	void internalTransition(int& s) const override {}
+
+	void externalTransition(int& s, double e) const override {
+		s += static_cast<int>(inGenerated->size());
+		if (s >= 5) {
+			throw cadmium::CadmiumModelException("faulty processor");
+		}
+	}
+
+	void output(const int& s) const override {}
+
+	[[nodiscard]] double timeAdvance(const int& s) const override {
+		return std::numeric_limits<double>::infinity();
+	}
+};
+
+//! Coupled model with several generators. Only the last one is connected to a faulty processor.
+struct FaultyGPT: public cadmium::Coupled {
+	explicit FaultyGPT(const std::string& id): cadmium::Coupled(id) {
+		for (int i = 0; i < 4; ++i) {
+			auto suffix = std::to_string(i);
+			auto generator = addComponent<Generator>("generator" + suffix, 1);
+			auto processor = (i == 3) ? addComponent<FaultyProcessor>("faulty" + suffix)->inGenerated : addComponent<Processor>("processor" + suffix, 2)->inGenerated;
+			addCoupling(generator->outGenerated, processor);
+		}
+	}
+};
+
+BOOST_AUTO_TEST_CASE(TimeWarpExceptionGPT)
+{
+	auto coordinator = cadmium::TimeWarpRootCoordinator(std::make_shared<FaultyGPT>("model"));
+	coordinator.setGVTPeriod(5);
+	coordinator.start();
+	BOOST_CHECK_THROW(coordinator.simulate(100, N_THREADS), cadmium::CadmiumModelException);
+}
+
+BOOST_AUTO_TEST_CASE(ConservativeExceptionGPT)
+{
+	auto coordinator = cadmium::ConservativeRootCoordinator(std::make_shared<FaultyGPT>("model"));
+	coordinator.start();
+	BOOST_CHECK_THROW(coordinator.simulate(100, N_THREADS), cadmium::CadmiumModelException);
+}
@@ -7,6 +7,9 @@
 #define BOOST_TEST_MODULE GridScenarioTests
 #include <boost/test/unit_test.hpp>
 #include <cadmium/celldevs/grid/scenario.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
 
 using namespace cadmium;
 using namespace cadmium::celldevs;
@@ -53,3 +56,87 @@ BOOST_AUTO_TEST_CASE(cell_in_scenario) {
 	BOOST_TEST(scenario.cellInScenario({-2, -1}));
 	BOOST_TEST(scenario.cellInScenario({-2, -2}));
 }
+
+BOOST_AUTO_TEST_CASE(wrapped_scenario) {
+	auto scenario = GridScenario({5, 4}, {-2, -1}, true);
+
+	// Wrapped scenarios with an origin other than zero wrap cells within the scenario bounds
+	BOOST_TEST(scenario.cellTo({2, 2}, {1, 1}) == coordinates({-2, -1}));
+	BOOST_TEST(scenario.cellFrom({1, 1}, {-2, -1}) == coordinates({2, 2}));
+	BOOST_TEST(scenario.cellTo(scenario.cellFrom({-1, 1}, {-2, -1}), {-1, 1}) == coordinates({-2, -1}));
+}
+
+BOOST_AUTO_TEST_CASE(fixed_dimension_scenario) {
+	auto dynamic = GridScenario({5, 4}, {-2, -1}, true);
+	auto fixed = BasicGridScenario<2>({5, 4}, {-2, -1}, true);
+	BOOST_CHECK_EXCEPTION(BasicGridScenario<2>({0, 4}, {0, 0}, false), CadmiumModelException, invalidShapeException);
+
+	std::vector<coordinates> dynamicCells;
+	for (const auto& cell: dynamic) {
+		dynamicCells.push_back(cell);
+	}
+	std::size_t nCells = 0;
+	for (const auto& cell: fixed) {
+		BOOST_CHECK(coordinates(cell.begin(), cell.end()) == dynamicCells.at(nCells++));
+	}
+	BOOST_CHECK_EQUAL(nCells, dynamicCells.size());
+
+	auto wrapped = BasicGridScenario<2>({5, 4}, {0, 0}, true);
+	BOOST_CHECK((wrapped.distanceVector({0, 0}, {4, 3}) == std::array<int, 2>{-1, -1}));
+	BOOST_CHECK((wrapped.cellTo({4, 3}, {1, 1}) == std::array<int, 2>{0, 0}));
+	BOOST_CHECK((wrapped.cellFrom({1, 1}, {0, 0}) == std::array<int, 2>{4, 3}));
+	BOOST_CHECK_EQUAL(wrapped.manhattanDistance({0, 0}, {4, 3}), 2);
+	BOOST_CHECK_EQUAL(wrapped.mooreNeighborhood(1).size(), 9);
+	BOOST_CHECK_EQUAL(wrapped.vonNeumannNeighborhood(1).size(), 5);
+
+	// Wrapped scenarios with an origin other than zero wrap cells within the scenario bounds
+	BOOST_CHECK((fixed.cellTo({2, 2}, {1, 1}) == std::array<int, 2>{-2, -1}));
+	BOOST_CHECK((fixed.cellFrom({1, 1}, {-2, -1}) == std::array<int, 2>{2, 2}));
+	BOOST_CHECK((fixed.cellTo(fixed.cellFrom({-1, 1}, {-2, -1}), {-1, 1}) == std::array<int, 2>{-2, -1}));
+}
+
+BOOST_AUTO_TEST_CASE(compile_time_stencils) {
+	static_assert(mooreStencil<2>().size() == 9);
+	static_assert(mooreStencil<3, 2>().size() == 125);
+	static_assert(vonNeumannStencil<2>().size() == 5);
+	static_assert(vonNeumannStencil<3, 2>().size() == 25);
+
+	auto scenario = BasicGridScenario<3>({5, 5, 5}, {0, 0, 0}, false);
+	auto moore = scenario.mooreNeighborhood(2);
+	auto vonNeumann = scenario.vonNeumannNeighborhood(2);
+	constexpr auto mooreStatic = mooreStencil<3, 2>();
+	constexpr auto vonNeumannStatic = vonNeumannStencil<3, 2>();
+	BOOST_CHECK(std::equal(moore.begin(), moore.end(), mooreStatic.begin(), mooreStatic.end()));
+	BOOST_CHECK(std::equal(vonNeumann.begin(), vonNeumann.end(), vonNeumannStatic.begin(), vonNeumannStatic.end()));
+}
+
+//! It computes the Morton code of a cell, assuming that the first dimension is the least significant one.
+unsigned long mortonCode(const GridScenario& scenario, const coordinates& cell) {
+	unsigned long code = 0;
+	auto nDims = scenario.shape.size();
+	for (std::size_t bit = 0; bit < 8; ++bit) {
+		for (std::size_t d = 0; d < nDims; ++d) {
+			code |= (static_cast<unsigned long>((cell[d] - scenario.origin[d]) >> bit) & 1UL) << (bit * nDims + d);
+		}
+	}
+	return code;
+}
+
+BOOST_AUTO_TEST_CASE(morton_order) {
+	for (auto scenario: {GridScenario({4, 4}, {-2, -1}, false), GridScenario({5, 3, 6}, {0, 1, 2}, true)}) {
+		std::vector<coordinates> cells;
+		for (const auto& cell: scenario) {
+			cells.push_back(cell);
+		}
+		std::sort(cells.begin(), cells.end(), [&scenario](const auto& a, const auto& b) { return scenario.mortonPrecedes(a, b); });
+		for (std::size_t i = 1; i < cells.size(); ++i) {
+			BOOST_CHECK_LT(mortonCode(scenario, cells[i - 1]), mortonCode(scenario, cells[i]));
+		}
+	}
+	auto scenario = GridScenario({4, 4}, {0, 0}, false);
+	BOOST_TEST(scenario.mortonPrecedes({1, 1}, {2, 0}));
+	BOOST_TEST(!scenario.mortonPrecedes({3, 0}, {0, 1}));
+	BOOST_TEST(scenario.mortonPrecedes({1, 0}, {0, 1}));
+	BOOST_TEST(!scenario.mortonPrecedes({2, 2}, {2, 2}));
+	BOOST_CHECK_THROW((void) scenario.mortonPrecedes({4, 0}, {0, 0}), CadmiumModelException);
+}
@@ -0,0 +1,314 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#define BOOST_TEST_MODULE GridSIRTests
+#include <boost/test/unit_test.hpp>
+#include <cadmium/celldevs/core/board.hpp>
+#include <cadmium/celldevs/grid/coupled.hpp>
+#include <cadmium/celldevs/grid/dense.hpp>
+#include <cadmium/celldevs/grid/sparse.hpp>
+#include <cadmium/core/simulation/root_coordinator.hpp>
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <typeinfo>
+#include "../../example/celldevs_sir/include/dense_grid_sir_rule.hpp"
+#include "../../example/celldevs_sir/include/grid_sir_cell.hpp"
+
+using namespace cadmium;
+using namespace cadmium::celldevs;
+using namespace cadmium::celldevs::example::sir;
+
+using States = std::map<std::string, SIRState>;  //!< Final state of every cell {cell ID: state}.
+
+std::shared_ptr<GridCell<SIRState, double, 2>> addGridCell(const gridCoordinates<2>& cellId, const std::shared_ptr<const GridCellConfig<SIRState, double, 2>>& cellConfig) {
+	if (cellConfig->cellModel == "default" || cellConfig->cellModel == "SIR") {
+		return std::make_shared<GridSIRCell>(cellId, cellConfig);
+	}
+	throw std::bad_typeid();
+}
+
+std::shared_ptr<DenseGridRule<SIRState, double>> addDenseGridRule(const std::shared_ptr<const GridCellConfig<SIRState, double>>& cellConfig) {
+	if (cellConfig->cellModel == "default" || cellConfig->cellModel == "SIR") {
+		return std::make_shared<DenseGridSIRRule>(cellConfig);
+	}
+	throw std::bad_typeid();
+}
+
+//! SIR rule that does not declare its constant output delay. Scenarios with this rule are event-driven.
+struct EventDrivenSIRRule: public DenseGridSIRRule {
+	using DenseGridSIRRule::DenseGridSIRRule;
+
+	bool constantDelay(double&) const override {
+		return false;
+	}
+};
+
+std::shared_ptr<DenseGridRule<SIRState, double>> addEventDrivenRule(const std::shared_ptr<const GridCellConfig<SIRState, double>>& cellConfig) {
+	if (cellConfig->cellModel == "default" || cellConfig->cellModel == "SIR") {
+		return std::make_shared<EventDrivenSIRRule>(cellConfig);
+	}
+	throw std::bad_typeid();
+}
+
+/**
+ * It generates the configuration of a grid SIR scenario with a few infected cells.
+ * @param shape shape of the scenario.
+ * @param origin origin of the scenario.
+ * @param wrapped if true, the scenario is wrapped.
+ * @param activeFrontier if true, cells have an active frontier.
+ * @return JSON object with the scenario configuration.
+ */
+nlohmann::json sirConfig(const coordinates& shape, const coordinates& origin, bool wrapped, bool activeFrontier) {
+	return {
+		{"scenario", {{"shape", shape}, {"origin", origin}, {"wrapped", wrapped}}},
+		{"cells", {
+			{"default", {
+				{"delay", "inertial"},
+				{"active_frontier", activeFrontier},
+				{"state", {{"p", 100}, {"s", 1}, {"i", 0}, {"r", 0}}},
+				{"config", {{"rec", 0.2}, {"susc", 0.8}, {"vir", 0.4}}},
+				{"neighborhood", {
+					{{"type", "von_neumann"}, {"vicinity", 0.25}, {"range", 1}},
+					{{"type", "relative"}, {"vicinity", 1}, {"neighbors", {{0, 0}}}},
+				}},
+			}},
+			{"infected", {
+				{"state", {{"s", 0.9}, {"i", 0.1}}},
+				{"cell_map", {origin, {origin[0] + shape[0] / 2, origin[1] + shape[1] / 3}}},
+			}},
+		}},
+	};
+}
+
+/**
+ * It writes a scenario configuration file.
+ * @param name name of the configuration file (without extension).
+ * @param config JSON object with the scenario configuration.
+ * @return path to the configuration file.
+ */
+std::string writeConfig(const std::string& name, const nlohmann::json& config) {
+	auto path = name + ".json";
+	std::ofstream(path) << config;
+	return path;
+}
+
+//! It simulates a grid SIR scenario with a regular Cell-DEVS coupled model and returns the final state of every cell.
+States coupledStates(const std::shared_ptr<GridCellDEVSCoupled<SIRState, double, 2>>& model, double simTime) {
+	auto rootCoordinator = RootCoordinator(model);
+	rootCoordinator.start();
+	rootCoordinator.simulate(simTime);
+	rootCoordinator.stop();
+	States states;
+	for (const auto& [cellId, cell]: model->getComponents()) {
+		states[cellId] = std::dynamic_pointer_cast<GridCell<SIRState, double, 2>>(cell)->getState();
+	}
+	return states;
+}
+
+//! It builds a grid SIR scenario with a regular Cell-DEVS coupled model and returns the final state of every cell.
+States coupledStates(const std::string& path, double simTime) {
+	auto model = std::make_shared<GridCellDEVSCoupled<SIRState, double, 2>>("sir", addGridCell, path);
+	model->buildModel();
+	return coupledStates(model, simTime);
+}
+
+//! It returns the current state of every cell of a dense grid Cell-DEVS scenario.
+States denseStates(const DenseGridCellDEVS<SIRState, double>& model) {
+	States states;
+	for (std::size_t i = 0; i < model.size(); ++i) {
+		states[model.cellId(i)] = model.getState(i);
+	}
+	return states;
+}
+
+//! It simulates a grid SIR scenario with a dense grid Cell-DEVS model and returns the final state of every cell.
+States denseStates(const std::string& path, double simTime, denseGridRuleFactory<SIRState, double> factory = addDenseGridRule) {
+	auto model = DenseGridCellDEVS<SIRState, double>("sir", factory, path);
+	model.buildModel();
+	model.start();
+	model.simulate(simTime);
+	model.stop();
+	return denseStates(model);
+}
+
+bool nonQuiescentException(const CadmiumModelException& ex) {
+	BOOST_CHECK_EQUAL(ex.what(), std::string("the default state of sparse grid Cell-DEVS scenarios must be quiescent"));
+	return true;
+}
+
+bool defaultAbsoluteException(const CadmiumModelException& ex) {
+	BOOST_CHECK_EQUAL(ex.what(), std::string("sparse grid Cell-DEVS scenarios do not support absolute neighbors in the default configuration"));
+	return true;
+}
+
+//! It checks that two simulations lead to the same final state of every cell.
+void checkStates(const States& expected, const States& states) {
+	BOOST_REQUIRE_EQUAL(expected.size(), states.size());
+	for (const auto& [cellId, state]: expected) {
+		BOOST_CHECK_MESSAGE(!(states.at(cellId) != state), "cell " << cellId << " differs: " << states.at(cellId) << " vs " << state);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(grid_neighbors) {
+	for (auto wrapped: {false, true}) {
+		for (auto shape: {coordinates{2, 2}, coordinates{6, 5}}) {
+			auto config = sirConfig(shape, {0, 0}, wrapped, false);
+			auto scenario = std::make_shared<BasicGridScenario<2>>(gridCoordinates<2>{shape[0], shape[1]}, gridCoordinates<2>{0, 0}, wrapped);
+			auto cellConfig = GridCellConfig<SIRState, double, 2>("default", config["cells"]["default"], scenario);
+			for (const auto& cell: *scenario) {
+				// Flat neighborhoods contain the same neighbors as the unordered map, each of them only once
+				auto neighbors = cellConfig.buildNeighbors(cell);
+				auto neighborhood = cellConfig.buildNeighborhood(cell);
+				BOOST_REQUIRE_EQUAL(neighbors.size(), neighborhood.size());
+				for (const auto& [neighbor, vicinity]: neighbors) {
+					BOOST_CHECK_EQUAL(*vicinity, neighborhood.at(neighbor).vicinity);
+				}
+				// Neighbors follow the stencil order (i.e., they are sorted by distance vector)
+				for (std::size_t slot = 1; !wrapped && slot < neighbors.size(); ++slot) {
+					auto prev = scenario->distanceVector(cell, neighbors[slot - 1].first);
+					auto next = scenario->distanceVector(cell, neighbors[slot].first);
+					BOOST_CHECK(prev < next);
+				}
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(board_sir) {
+	for (auto activeFrontier: {false, true}) {
+		auto path = writeConfig("board_sir", sirConfig({20, 15}, {-5, -3}, false, activeFrontier));
+		auto expected = coupledStates(path, 30);
+
+		auto model = std::make_shared<GridCellDEVSCoupled<SIRState, double, 2>>("sir", addGridCell, path);
+		model->buildCells();
+		auto rootCoordinator = CellDEVSBoardRootCoordinator<gridCoordinates<2>, SIRState, double>(model);
+		rootCoordinator.start();
+		rootCoordinator.simulate(30.);
+		rootCoordinator.stop();
+		States states;
+		for (std::size_t i = 0; i < rootCoordinator.size(); ++i) {
+			states[rootCoordinator.getCell(i)->getId()] = rootCoordinator.getCell(i)->getState();
+		}
+		checkStates(expected, states);
+		// Some cells must have been infected, or the comparison would be trivial
+		BOOST_CHECK(std::any_of(states.begin(), states.end(), [](const auto& entry) { return entry.second.r > 0; }));
+	}
+
+	// Cells must be indexed
+	auto model = std::make_shared<GridCellDEVSCoupled<SIRState, double, 2>>("sir", addGridCell, writeConfig("board_sir", sirConfig({5, 5}, {0, 0}, false, true)));
+	model->loadCellConfigs();
+	static_cast<CellDEVSCoupled<gridCoordinates<2>, SIRState, double>&>(*model).addCells();
+	BOOST_CHECK_THROW((CellDEVSBoardRootCoordinator<gridCoordinates<2>, SIRState, double>(model)), CadmiumModelException);
+}
+
+BOOST_AUTO_TEST_CASE(dense_sir) {
+	for (auto wrapped: {false, true}) {
+		for (auto activeFrontier: {false, true}) {
+			auto config = sirConfig({20, 15}, {-5, -3}, wrapped, activeFrontier);
+			config["scenario"]["synchronous"] = false;
+			auto path = writeConfig("dense_sir", config);
+			checkStates(coupledStates(path, 30), denseStates(path, 30));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(dense_synchronous_sir) {
+	for (auto wrapped: {false, true}) {
+		auto config = sirConfig({20, 15}, {-5, -3}, wrapped, false);
+		config["scenario"]["synchronous"] = false;
+		auto expected = denseStates(writeConfig("dense_sir", config), 30);
+		config["scenario"]["synchronous"] = true;
+		auto path = writeConfig("dense_sir", config);
+		checkStates(expected, denseStates(path, 30));
+		// Rules without a constant output delay cannot be simulated synchronously
+		BOOST_CHECK_THROW(denseStates(path, 30, addEventDrivenRule), CadmiumModelException);
+		// Otherwise, they fall back to the event-driven mode
+		config["scenario"].erase("synchronous");
+		checkStates(expected, denseStates(writeConfig("dense_sir", config), 30, addEventDrivenRule));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(sparse_sir) {
+	for (auto wrapped: {false, true}) {
+		for (auto activeFrontier: {false, true}) {
+			auto path = writeConfig("sparse_sir", sirConfig({60, 45}, {-5, -3}, wrapped, activeFrontier));
+			auto expected = denseStates(path, 10);
+
+			auto model = SparseGridCellDEVS<SIRState, double>("sir", addDenseGridRule, path);
+			model.buildModel();
+			// Only the infected cells are materialized from the beginning
+			BOOST_CHECK_EQUAL(model.nMaterialized(), 2);
+			model.start();
+			model.simulate(10.);
+			model.stop();
+			// Cells are materialized as the infection spreads, but most of them remain virtual
+			std::size_t nChanged = std::count_if(expected.begin(), expected.end(), [](const auto& entry) { return entry.second.r > 0; });
+			BOOST_CHECK_GT(nChanged, 2);
+			BOOST_CHECK_GE(model.nMaterialized(), nChanged);
+			BOOST_CHECK_LT(model.nMaterialized(), model.size() / 2);
+			// Materialized cells behave as dense cells, and virtual cells keep the default state
+			checkStates(expected, denseStates(model));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(sparse_invalid) {
+	// The default state must be quiescent
+	auto config = sirConfig({10, 10}, {0, 0}, false, false);
+	config["cells"]["default"]["state"] = {{"p", 100}, {"s", 0.9}, {"i", 0.1}, {"r", 0}};
+	auto model = SparseGridCellDEVS<SIRState, double>("sir", addDenseGridRule, writeConfig("sparse_sir", config));
+	BOOST_CHECK_EXCEPTION(model.buildModel(), CadmiumModelException, nonQuiescentException);
+	// The default configuration cannot have absolute neighbors
+	config = sirConfig({10, 10}, {0, 0}, false, false);
+	config["cells"]["default"]["neighborhood"].push_back({{"type", "absolute"}, {"vicinity", 1}, {"neighbors", {{0, 0}}}});
+	model = SparseGridCellDEVS<SIRState, double>("sir", addDenseGridRule, writeConfig("sparse_sir", config));
+	BOOST_CHECK_EXCEPTION(model.buildModel(), CadmiumModelException, defaultAbsoluteException);
+}
+
+BOOST_AUTO_TEST_CASE(replica_sir) {
+	using GridSIRCoupled = GridCellDEVSCoupled<SIRState, double, 2>;
+	auto config = sirConfig({20, 15}, {-5, -3}, false, false);
+	auto prototype = std::make_shared<GridSIRCoupled>("sir", addGridCell, writeConfig("replica_sir", config));
+	prototype->buildCells();
+	// Replicas without a patch share the topology and the cell configurations of the prototype
+	auto model = std::make_shared<GridSIRCoupled>("sir", addGridCell, writeConfig("replica_sir", config));
+	model->buildModel();
+	auto replica = std::make_shared<GridSIRCoupled>("sir", *prototype);
+	replica->buildModel();
+	BOOST_CHECK_EQUAL(replica->getSerialICs().size(), model->getSerialICs().size());
+	checkStates(coupledStates(model, 30), coupledStates(replica, 30));
+
+	// Replicas with a patch only load again the patched cell configurations
+	for (auto vir: {0.2, 0.6}) {
+		nlohmann::json patch = {{"infected", {{"state", {{"s", 0.8}, {"i", 0.2}}}}}, {"default", {{"config", {{"vir", vir}}}}}};
+		auto replica = std::make_shared<GridSIRCoupled>("sir", *prototype, patch);
+		replica->buildModel();
+		auto patched = config;
+		patched["cells"].merge_patch(patch);
+		checkStates(coupledStates(writeConfig("replica_sir", patched), 30), coupledStates(replica, 30));
+	}
+	replica = std::make_shared<GridSIRCoupled>("sir", *prototype, nlohmann::json{{"infected", {{"state", {{"i", 0.3}}}}}});
+	replica->buildModel();
+	auto prototypeCells = prototype->getCells();
+	auto replicaCells = replica->getCells();
+	for (std::size_t i = 0; i < replicaCells.size(); ++i) {
+		auto shared = replicaCells[i]->getCellConfig() == prototypeCells[i]->getCellConfig();
+		BOOST_CHECK_EQUAL(shared, replicaCells[i]->getCellConfig()->configId == "default");
+		// Replicas point to the vicinity factors of the prototype, even if their cell configuration is patched
+		auto replicaNeighbors = replicaCells[i]->getNeighbors();
+		auto prototypeNeighbors = prototypeCells[i]->getNeighbors();
+		BOOST_REQUIRE_EQUAL(replicaNeighbors.size(), prototypeNeighbors.size());
+		for (std::size_t slot = 0; slot < replicaNeighbors.size(); ++slot) {
+			BOOST_CHECK_EQUAL(&replicaNeighbors[slot].vicinity, &prototypeNeighbors[slot].vicinity);
+		}
+	}
+	// Patches cannot add cell configurations
+	BOOST_CHECK_THROW(GridSIRCoupled("sir", *prototype, nlohmann::json{{"unknown", {{"config", {{"vir", 0.1}}}}}}), CadmiumModelException);
+}
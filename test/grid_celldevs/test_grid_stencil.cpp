@@ -0,0 +1,78 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#define BOOST_TEST_MODULE GridStencilTests
+#include <boost/test/unit_test.hpp>
+#include <cadmium/celldevs/grid/scenario.hpp>
+#include <cadmium/celldevs/grid/stencil.hpp>
+
+using namespace cadmium;
+using namespace cadmium::celldevs;
+
+//! It checks that the stencil finds the same neighbors as the scenario for every cell and distance vector.
+void checkStencil(GridScenario& scenario, const std::vector<coordinates>& distances) {
+	auto stencil = GridStencil(scenario, distances);
+	std::size_t nCells = 0;
+	for (const auto& cell: scenario) {
+		auto index = stencil.cellIndex(cell);
+		BOOST_CHECK_EQUAL(index, nCells++);
+		BOOST_CHECK(stencil.cellCoordinates(index) == cell);
+		auto interior = stencil.isInterior(index);
+		for (std::size_t k = 0; k < stencil.size(); ++k) {
+			for (auto inner: {interior, false}) {
+				std::size_t res{};
+				try {
+					auto cellTo = scenario.cellTo(cell, distances[k]);
+					BOOST_CHECK(stencil.cellTo(index, k, inner, res));
+					BOOST_CHECK(stencil.cellCoordinates(res) == cellTo);
+				} catch (const CadmiumModelException&) {
+					BOOST_CHECK(!stencil.cellTo(index, k, inner, res));
+				}
+				try {
+					auto cellFrom = scenario.cellFrom(distances[k], cell);
+					BOOST_CHECK(stencil.cellFrom(index, k, inner, res));
+					BOOST_CHECK(stencil.cellCoordinates(res) == cellFrom);
+				} catch (const CadmiumModelException&) {
+					BOOST_CHECK(!stencil.cellFrom(index, k, inner, res));
+				}
+			}
+		}
+	}
+	BOOST_CHECK_EQUAL(stencil.nCells(), nCells);
+}
+
+BOOST_AUTO_TEST_CASE(stencil_neighbors) {
+	auto scenario = GridScenario({5, 4}, {-2, -1}, false);
+	checkStencil(scenario, scenario.mooreNeighborhood(1));
+	checkStencil(scenario, {{2, -1}, {0, 3}});
+
+	auto wrapped = GridScenario({5, 4}, {0, 0}, true);
+	checkStencil(wrapped, wrapped.mooreNeighborhood(1));
+	checkStencil(wrapped, {{2, -1}, {0, 3}});
+
+	auto cube = GridScenario({3, 4, 5}, {0, 0, 0}, false);
+	checkStencil(cube, cube.vonNeumannNeighborhood(2));
+}
+
+BOOST_AUTO_TEST_CASE(stencil_interior) {
+	auto scenario = GridScenario({5, 5}, {0, 0}, false);
+	auto stencil = GridStencil(scenario, scenario.mooreNeighborhood(1));
+	BOOST_TEST(stencil.isInterior(stencil.cellIndex({2, 2})));
+	BOOST_TEST(stencil.isInterior(stencil.cellIndex({1, 3})));
+	BOOST_TEST(!stencil.isInterior(stencil.cellIndex({0, 2})));
+	BOOST_TEST(!stencil.isInterior(stencil.cellIndex({2, 4})));
+
+	// In small wrapped scenarios, cells are never interior (different distance vectors lead to the same neighbor)
+	auto small = GridScenario({2, 5}, {0, 0}, true);
+	auto smallStencil = GridStencil(small, small.mooreNeighborhood(1));
+	for (std::size_t cell = 0; cell < smallStencil.nCells(); ++cell) {
+		BOOST_TEST(!smallStencil.isInterior(cell));
+	}
+
+	BOOST_CHECK_THROW(GridStencil(scenario, {{5, 0}}), CadmiumModelException);
+	BOOST_CHECK_THROW((void) stencil.cellIndex({5, 0}), CadmiumModelException);
+	BOOST_CHECK_THROW((void) stencil.cellIndex({0}), CadmiumModelException);
+}
@@ -0,0 +1,125 @@
+/**
+ * SPDX-License-Identifier: MIT
+ * Copyright (c) 2022-present Román Cárdenas Rodríguez
+ * ARSLab - Carleton University
+ */
+
+#define BOOST_TEST_MODULE ParallelTiledSIRTests
+#include <boost/test/unit_test.hpp>
+#include <cadmium/celldevs/grid/dense.hpp>
+#include <cadmium/celldevs/grid/tiled.hpp>
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include "../../example/celldevs_sir/include/dense_grid_sir_rule.hpp"
+
+using namespace cadmium;
+using namespace cadmium::celldevs;
+using namespace cadmium::celldevs::example::sir;
+
+using States = std::map<std::string, SIRState>;  //!< Final state of every cell {cell ID: state}.
+
+std::shared_ptr<DenseGridRule<SIRState, double>> addDenseGridRule(const std::shared_ptr<const GridCellConfig<SIRState, double>>& cellConfig) {
+	if (cellConfig->cellModel == "default" || cellConfig->cellModel == "SIR") {
+		return std::make_shared<DenseGridSIRRule>(cellConfig);
+	}
+	throw std::bad_typeid();
+}
+
+/**
+ * It writes the configuration file of a grid SIR scenario with a few infected cells.
+ * Cells have a range-2 von Neumann neighborhood, so halos are two cells wide.
+ * Besides, all the cells have two absolute neighbors placed in opposite corners of the scenario.
+ * @param wrapped if true, the scenario is wrapped.
+ * @param activeFrontier if true, cells have an active frontier.
+ * @return path to the configuration file.
+ */
+std::string writeConfig(bool wrapped, bool activeFrontier) {
+	nlohmann::json config = {
+		{"scenario", {{"shape", {20, 15}}, {"origin", {-5, -3}}, {"wrapped", wrapped}}},
+		{"cells", {
+			{"default", {
+				{"delay", "inertial"},
+				{"active_frontier", activeFrontier},
+				{"state", {{"p", 100}, {"s", 1}, {"i", 0}, {"r", 0}}},
+				{"config", {{"rec", 0.2}, {"susc", 0.8}, {"vir", 0.4}}},
+				{"neighborhood", {
+					{{"type", "von_neumann"}, {"vicinity", 0.1}, {"range", 2}},
+					{{"type", "relative"}, {"vicinity", 1}, {"neighbors", {{0, 0}}}},
+					{{"type", "absolute"}, {"vicinity", 0.05}, {"neighbors", {{-5, -3}, {14, 11}}}},
+				}},
+			}},
+			{"infected", {
+				{"state", {{"s", 0.9}, {"i", 0.1}}},
+				{"cell_map", {{-5, -3}, {5, 2}}},
+			}},
+		}},
+	};
+	std::string path = "tiled_sir.json";
+	std::ofstream(path) << config;
+	return path;
+}
+
+/**
+ * It simulates a dense grid Cell-DEVS model and returns the final state of every cell.
+ * @param model dense grid Cell-DEVS model. It must be already built.
+ * @return final state of every cell.
+ */
+States simulate(DenseGridCellDEVS<SIRState, double>& model) {
+	model.start();
+	model.simulate(30.);
+	model.stop();
+	States states;
+	for (std::size_t i = 0; i < model.size(); ++i) {
+		states[model.cellId(i)] = model.getState(i);
+	}
+	return states;
+}
+
+BOOST_AUTO_TEST_CASE(tiled_sir) {
+	// Some layouts do not divide the 20x15 grid evenly, and the last one leaves tiles smaller than their halo
+	std::vector<coordinates> layouts = {{}, {1, 1}, {2, 1}, {1, 4}, {3, 2}, {6, 4}, {20, 15}};
+	for (auto wrapped: {false, true}) {
+		for (auto activeFrontier: {false, true}) {
+			auto path = writeConfig(wrapped, activeFrontier);
+			auto dense = DenseGridCellDEVS<SIRState, double>("sir", addDenseGridRule, path);
+			dense.buildModel();
+			auto expected = simulate(dense);
+			BOOST_CHECK(std::any_of(expected.begin(), expected.end(), [](const auto& entry) { return entry.second.r > 0; }));
+
+			for (std::size_t l = 0; l < layouts.size(); ++l) {
+				auto tiled = TiledGridCellDEVS<SIRState, double>("sir", addDenseGridRule, path, layouts[l]);
+				tiled.buildModel();
+				auto states = simulate(tiled);
+				BOOST_REQUIRE_EQUAL(expected.size(), states.size());
+				for (const auto& [cellId, state]: expected) {
+					BOOST_CHECK_MESSAGE(!(states.at(cellId) != state), "cell " << cellId << " differs with tile layout " << l);
+				}
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(invalid_tiles) {
+	auto path = writeConfig(false, false);
+	for (const coordinates& layout: {coordinates{0, 1}, coordinates{21, 1}, coordinates{1, 16}, coordinates{2, 2, 2}}) {
+		auto tiled = TiledGridCellDEVS<SIRState, double>("sir", addDenseGridRule, path, layout);
+		BOOST_CHECK_THROW(tiled.buildModel(), CadmiumModelException);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(synchronous_tiles) {
+	// Tiles never run synchronously, so scenarios that require the synchronous mode are rejected
+	auto path = writeConfig(false, false);
+	nlohmann::json config;
+	std::ifstream(path) >> config;
+	config["scenario"]["synchronous"] = true;
+	std::ofstream(path) << config;
+	auto tiled = TiledGridCellDEVS<SIRState, double>("sir", addDenseGridRule, path);
+	BOOST_CHECK_THROW(tiled.buildModel(), CadmiumModelException);
+}